@@ -67,10 +67,34 @@
 #include <fstream>
 #include <filesystem>
 #include <vector>
+#include <utility>
+#include <cstdlib>
+#include <atomic>
+// BLAKE3 splits large inputs and files across threads unless HASHPP_DISABLE_THREADS
+// is defined before including this header
+#if !defined(HASHPP_DISABLE_THREADS)
+#include <thread>
+#include <system_error>
+#endif
 #if defined(HASHPP_INCLUDE_METRICS)
 #include <chrono>
 #endif
 
+// x86 instruction set extensions (e.g., the SHA extensions) are detected at
+// runtime and used when present--defining HASHPP_DISABLE_INTRINSICS before
+// including this header restricts hash++ to its portable implementations
+#if !defined(HASHPP_DISABLE_INTRINSICS) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define HASHPP_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define HASHPP_TARGET(x)
+#else
+#include <immintrin.h>
+#include <cpuid.h>
+#define HASHPP_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
 namespace hashpp {
 	enum class ALGORITHMS : uint8_t {
 		// MDX Family
@@ -79,9 +103,154 @@ namespace hashpp {
 		// SHA-X Family
 		SHA1, SHA2_224, SHA2_256,
 		SHA2_384, SHA2_512, SHA2_512_224,
-		SHA2_512_256 /*, SHA3_224, SHA3_256,
+		SHA2_512_256, SHA3_224, SHA3_256,
 		SHA3_384, SHA3_512, SHAKE128,
-		SHAKE256 */
+		SHAKE256,
+
+		// BLAKE Family
+		BLAKE2B, BLAKE2S, BLAKE3
+	};
+
+	// encodings the getHashes interfaces can hash their input strings as;
+	// UTF16LE widens ASCII/UTF-8 input to UTF-16LE (as used by NTLM) while
+	// hashing, with malformed UTF-8 sequences encoded as U+FFFD
+	enum class ENCODINGS : uint8_t {
+		BYTES, UTF16LE
+	};
+
+	// class used to query the instruction set extensions supported
+	// by the host processor, probed once via CPUID on first use so
+	// that accelerated kernels can be selected at runtime
+	//
+	// extensions can be withheld from hash++ to force slower kernels (e.g., to compare
+	// them) with a comma-separated list of sse2, ssse3, sse4.1, sse4.2, avx2, bmi2,
+	// avx512, avx512vbmi and sha, or "all" for the portable implementations only, in
+	// the HASHPP_DISABLE_EXTENSIONS environment variable or via disable()
+	class cpu {
+	public:
+		static bool hasSSE2() noexcept { return features().sse2; }
+		static bool hasSSSE3() noexcept { return features().ssse3; }
+		static bool hasSSE41() noexcept { return features().sse41; }
+		static bool hasSSE42() noexcept { return features().sse42; }
+		static bool hasSHA() noexcept { return features().sha; }
+		static bool hasAVX2() noexcept { return features().avx2; }
+		static bool hasBMI2() noexcept { return features().bmi2; }
+		static bool hasAVX512() noexcept { return features().avx512; }
+		static bool hasAVX512VBMI() noexcept { return features().avx512vbmi; }
+
+		// withholds the listed extensions (replacing any previous list, so an empty
+		// list restores all of them) and rebinds the kernels; not safe to call while
+		// other threads are hashing
+		static void disable(const std::string& extensions);
+
+		// name of the single-stream kernel currently bound for an algorithm
+		// (e.g., "sha-ni", "avx2" or "generic")
+		static const char* kernel(hashpp::ALGORITHMS algorithm) noexcept;
+
+	private:
+		struct flags {
+			bool sse2, ssse3, sse41, sse42, avx2, bmi2, avx512, avx512vbmi, sha;
+		};
+
+		static flags& features() noexcept {
+			static flags f = withhold(detected(), std::getenv("HASHPP_DISABLE_EXTENSIONS"));
+			return f;
+		}
+
+		static const flags& detected() noexcept {
+			static const flags f = detect();
+			return f;
+		}
+
+		// clears the extensions named in 'list' and those depending on them
+		static flags withhold(flags f, const char* list) noexcept {
+			for (const char* p = list; p != nullptr && *p != '\0';) {
+				const char* end = p;
+				while (*end != '\0' && *end != ',') {
+					++end;
+				}
+				const std::string name(p, end);
+				f.sse2 = f.sse2 && name != "sse2" && name != "all";
+				f.ssse3 = f.ssse3 && name != "ssse3" && name != "all";
+				f.sse41 = f.sse41 && name != "sse4.1" && name != "all";
+				f.sse42 = f.sse42 && name != "sse4.2" && name != "all";
+				f.avx2 = f.avx2 && name != "avx2" && name != "all";
+				f.bmi2 = f.bmi2 && name != "bmi2" && name != "all";
+				f.avx512 = f.avx512 && name != "avx512" && name != "all";
+				f.avx512vbmi = f.avx512vbmi && name != "avx512vbmi" && name != "all";
+				f.sha = f.sha && name != "sha" && name != "all";
+				p = *end == ',' ? end + 1 : end;
+			}
+
+			f.ssse3 = f.ssse3 && f.sse2;
+			f.sse41 = f.sse41 && f.ssse3;
+			f.sse42 = f.sse42 && f.sse41;
+			f.avx512 = f.avx512 && f.avx2;
+			f.avx512vbmi = f.avx512vbmi && f.avx512;
+			f.sha = f.sha && f.sse41;
+			return f;
+		}
+
+		static flags detect() noexcept {
+			flags f = { false, false, false, false, false, false, false, false, false };
+#if defined(HASHPP_X86)
+			uint32_t r[4] = { 0 };
+			cpuid(0, 0, r);
+			const uint32_t maxLeaf = r[0];
+			bool ymm = false, zmm = false;
+
+			if (maxLeaf >= 1) {
+				cpuid(1, 0, r);
+				f.sse2 = (r[3] >> 26) & 1;
+				f.ssse3 = (r[2] >> 9) & 1;
+				f.sse41 = (r[2] >> 19) & 1;
+				f.sse42 = (r[2] >> 20) & 1;
+
+				// AVX registers are only usable if the OS saves their state (XCR0 bits 1 and 2),
+				// likewise the AVX-512 opmask and upper ZMM registers (XCR0 bits 5 through 7)
+				if (((r[2] >> 27) & 1) && ((r[2] >> 28) & 1)) {
+					const uint64_t xcr0 = xgetbv();
+					ymm = (xcr0 & 0x6) == 0x6;
+					zmm = (xcr0 & 0xE6) == 0xE6;
+				}
+			}
+			if (maxLeaf >= 7) {
+				cpuid(7, 0, r);
+				f.avx2 = ymm && ((r[1] >> 5) & 1);
+				f.bmi2 = (r[1] >> 8) & 1;
+				// AVX-512 kernels require the foundation, byte/word and vector length subsets
+				f.avx512 = zmm && f.avx2 && ((r[1] >> 16) & 1) && ((r[1] >> 30) & 1) && ((r[1] >> 31) & 1);
+				f.avx512vbmi = f.avx512 && ((r[2] >> 1) & 1);
+				// the SHA kernels also rely on SSSE3/SSE4.1 shuffles and blends
+				f.sha = ((r[1] >> 29) & 1) && f.ssse3 && f.sse41;
+			}
+#endif
+			return f;
+		}
+
+#if defined(HASHPP_X86)
+		static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t r[4]) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+			int regs[4];
+			__cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for (uint32_t i = 0; i < 4; ++i) {
+				r[i] = static_cast<uint32_t>(regs[i]);
+			}
+#else
+			__cpuid_count(leaf, subleaf, r[0], r[1], r[2], r[3]);
+#endif
+		}
+
+		static uint64_t xgetbv() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+			return _xgetbv(0);
+#else
+			uint32_t eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+		}
+#endif
 	};
 
 	// class containing common data and methods to be
@@ -195,6 +364,11 @@ namespace hashpp {
 		}
 
 	private:
+#if defined(HASHPP_INCLUDE_METRICS)
+		// metrics::checkKernels feeds the contexts directly to vary the update chunking
+		template <bool, class> friend class metrics;
+#endif
+
 		std::string bytesToHexString() {
 			const std::vector<uint8_t> digest = this->getBytes();
 			std::string hash;
@@ -207,1213 +381,4895 @@ namespace hashpp {
 		}
 	};
 
-	// Message Digest (MDX) hash family - excluding MD6
-	namespace MD {
-		class MD5 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 16);
-			}
-
-			// private members
-		private:
-			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 16;
+	// accelerated compression kernels shared by the algorithm classes;
+	// each kernel is only called after the cpu class has confirmed
+	// support for the instruction set extensions it is compiled for
+	namespace simd {
+		// MD5 sine-derived constants (T) and per-round rotate amounts
+		// as per: https://datatracker.ietf.org/doc/html/rfc1321
+		alignas(64) inline constexpr uint32_t MD5_K[64] = {
+			0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+			0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+			0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+			0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+			0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+			0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+			0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+			0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+		};
+		inline constexpr uint32_t MD5_S[16] = {
+			7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21
+		};
+		inline constexpr uint32_t MD5_H[4] = {
+			0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476
+		};
 
-			typedef struct {
-				uint64_t size;
-				uint32_t buf[4];
-				uint8_t  in[64], digest[16];
-			} CTX;
+		// block and length-encoding layout of the MD5 compression
+		struct md5_traits {
+			typedef uint32_t word;
+			static constexpr size_t WORDS = 4, BLOCK = 64, LENGTH = 8;
+			static constexpr bool MSB_FIRST = false;
+		};
 
-			// CTX context instance
-			CTX context = { 0 };
+		// left rotate by a compile-time amount, so every unrolled step below
+		// encodes its rotate as an immediate
+		template <uint32_t _S>
+		constexpr uint32_t rotl32(uint32_t x) noexcept {
+			return (x << _S) | (x >> (32 - _S));
+		}
 
-			// per-round shift amounts
-			// as per: https://en.wikipedia.org/wiki/MD5#Pseudocode
-			const uint8_t S[64] = {
-				7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-				5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-				4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-				6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-			};
+		// MD5 step _I; the round function, message word, constant and rotate are all
+		// fixed at compile time, and r[(4 - _I) & 3] is the word the step updates,
+		// followed by the other three in order
+		template <size_t _I>
+		inline void md5_step(uint32_t r[4], const uint32_t m[16]) noexcept {
+			uint32_t& a = r[(4 - _I) & 3];
+			const uint32_t b = r[(5 - _I) & 3], c = r[(6 - _I) & 3], d = r[(7 - _I) & 3];
+			constexpr size_t g = _I < 16 ? _I : _I < 32 ? (5 * _I + 1) & 15 : _I < 48 ? (3 * _I + 5) & 15 : (7 * _I) & 15;
+			uint32_t f;
 
-			// as per: https://en.wikipedia.org/wiki/MD5#Pseudocode
-			const uint32_t K[64] = {
-				0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-				0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-				0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-				0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-				0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-				0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-				0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-				0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-			};
+			if constexpr (_I < 16) {
+				f = d ^ (b & (c ^ d));
+			}
+			else if constexpr (_I < 32) {
+				f = c ^ (d & (b ^ c));
+			}
+			else if constexpr (_I < 48) {
+				f = b ^ c ^ d;
+			}
+			else {
+				f = c ^ (b | ~d);
+			}
+			a = b + rotl32<MD5_S[((_I >> 4) << 2) | (_I & 3)]>(a + f + MD5_K[_I] + m[g]);
+		}
 
-			// pad data for when we need to... well.. pad to appropriate size
-			uint8_t pad[64] = {
-				0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-			};
+		template <size_t... _I>
+		inline void md5_steps(uint32_t r[4], const uint32_t m[16], std::index_sequence<_I...>) noexcept {
+			(md5_step<_I>(r, m), ...);
+		}
 
-			// MD5 algorithm-defined constants 
-			// as per: https://en.wikipedia.org/wiki/MD5#Pseudocode
-			const uint32_t A = 0x67452301;
-			const uint32_t B = 0xefcdab89;
-			const uint32_t C = 0x98badcfe;
-			const uint32_t D = 0x10325476;
+		// portable MD5 compression of 'blocks' consecutive 64-byte blocks,
+		// with its 64 steps unrolled at compile time
+		inline void md5_generic(uint32_t state[4], const uint8_t* data, size_t blocks) {
+			for (; blocks != 0; --blocks, data += 64) {
+				uint32_t m[16], r[4] = { state[0], state[1], state[2], state[3] };
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+				for (uint32_t i = 0; i < 16; ++i) {
+					m[i] = static_cast<uint32_t>(data[i * 4]) | (static_cast<uint32_t>(data[i * 4 + 1]) << 8) |
+						(static_cast<uint32_t>(data[i * 4 + 2]) << 16) | (static_cast<uint32_t>(data[i * 4 + 3]) << 24);
+				}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+				md5_steps(r, m, std::make_index_sequence<64>());
 
-			// private class methods
-		private:
-			// initialize our context for this hash function
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint32_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+				state[0] += r[0]; state[1] += r[1]; state[2] += r[2]; state[3] += r[3];
+			}
+		}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		// MD4 shares MD5's initial values, block size and length encoding
+		// as per: https://datatracker.ietf.org/doc/html/rfc1320
+		typedef md5_traits md4_traits;
 
-			// auxiliary functions defined by the algorithm
-			// as per: https://en.wikipedia.org/wiki/MD5#Algorithm
-			constexpr uint32_t F(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t G(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t H(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t I(const uint32_t B, const uint32_t C, const uint32_t D);
+		// MD4 per-round rotate amounts and message word order
+		inline constexpr uint32_t MD4_S[12] = { 3, 7, 11, 19, 3, 5, 9, 13, 3, 9, 11, 15 };
+		inline constexpr uint32_t MD4_X[48] = {
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+			0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+			0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15
 		};
-		class MD4 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 16);
+
+		// MD4 step _I, laid out as md5_step above
+		template <size_t _I>
+		inline void md4_step(uint32_t r[4], const uint32_t m[16]) noexcept {
+			uint32_t& a = r[(4 - _I) & 3];
+			const uint32_t b = r[(5 - _I) & 3], c = r[(6 - _I) & 3], d = r[(7 - _I) & 3];
+			uint32_t f;
+
+			if constexpr (_I < 16) {
+				f = d ^ (b & (c ^ d));
+			}
+			else if constexpr (_I < 32) {
+				f = ((b & c) | (d & (b | c))) + 0x5a827999;
+			}
+			else {
+				f = (b ^ c ^ d) + 0x6ed9eba1;
 			}
+			a = rotl32<MD4_S[((_I >> 4) << 2) | (_I & 3)]>(a + f + m[MD4_X[_I]]);
+		}
 
-			// private members
-		private:
-			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 16;
+		template <size_t... _I>
+		inline void md4_steps(uint32_t r[4], const uint32_t m[16], std::index_sequence<_I...>) noexcept {
+			(md4_step<_I>(r, m), ...);
+		}
 
-			typedef struct {
-				uint64_t size;
-				uint32_t buf[4];
-				uint8_t  in[64], digest[16];
-			} CTX;
+		// portable MD4 compression of 'blocks' consecutive 64-byte blocks,
+		// with its 48 steps unrolled at compile time
+		inline void md4_generic(uint32_t state[4], const uint8_t* data, size_t blocks) {
+			for (; blocks != 0; --blocks, data += 64) {
+				uint32_t m[16], r[4] = { state[0], state[1], state[2], state[3] };
 
-			// CTX context instance
-			CTX context = { 0 };
+				for (uint32_t i = 0; i < 16; ++i) {
+					m[i] = static_cast<uint32_t>(data[i * 4]) | (static_cast<uint32_t>(data[i * 4 + 1]) << 8) |
+						(static_cast<uint32_t>(data[i * 4 + 2]) << 16) | (static_cast<uint32_t>(data[i * 4 + 3]) << 24);
+				}
 
-			const uint8_t S[64] = {
-				7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-				5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-				4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-				6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-			};
+				md4_steps(r, m, std::make_index_sequence<48>());
 
-			const uint32_t K[64] = {
-				0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-				0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-				0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-				0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-				0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-				0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-				0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-				0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-			};
+				state[0] += r[0]; state[1] += r[1]; state[2] += r[2]; state[3] += r[3];
+			}
+		}
 
-			// pad data for when we need to... well.. pad to appropriate size
-			uint8_t pad[64] = {
-				0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-			};
+		// MD2 S-table (a permutation of 0-255 derived from the digits of pi)
+		// as per: https://datatracker.ietf.org/doc/html/rfc1319
+		alignas(64) inline constexpr uint8_t MD2_S[256] = {
+			0x29, 0x2E, 0x43, 0xC9, 0xA2, 0xD8, 0x7C, 0x01, 0x3D, 0x36, 0x54, 0xA1, 0xEC, 0xF0, 0x06, 0x13,
+			0x62, 0xA7, 0x05, 0xF3, 0xC0, 0xC7, 0x73, 0x8C, 0x98, 0x93, 0x2B, 0xD9, 0xBC, 0x4C, 0x82, 0xCA,
+			0x1E, 0x9B, 0x57, 0x3C, 0xFD, 0xD4, 0xE0, 0x16, 0x67, 0x42, 0x6F, 0x18, 0x8A, 0x17, 0xE5, 0x12,
+			0xBE, 0x4E, 0xC4, 0xD6, 0xDA, 0x9E, 0xDE, 0x49, 0xA0, 0xFB, 0xF5, 0x8E, 0xBB, 0x2F, 0xEE, 0x7A,
+			0xA9, 0x68, 0x79, 0x91, 0x15, 0xB2, 0x07, 0x3F, 0x94, 0xC2, 0x10, 0x89, 0x0B, 0x22, 0x5F, 0x21,
+			0x80, 0x7F, 0x5D, 0x9A, 0x5A, 0x90, 0x32, 0x27, 0x35, 0x3E, 0xCC, 0xE7, 0xBF, 0xF7, 0x97, 0x03,
+			0xFF, 0x19, 0x30, 0xB3, 0x48, 0xA5, 0xB5, 0xD1, 0xD7, 0x5E, 0x92, 0x2A, 0xAC, 0x56, 0xAA, 0xC6,
+			0x4F, 0xB8, 0x38, 0xD2, 0x96, 0xA4, 0x7D, 0xB6, 0x76, 0xFC, 0x6B, 0xE2, 0x9C, 0x74, 0x04, 0xF1,
+			0x45, 0x9D, 0x70, 0x59, 0x64, 0x71, 0x87, 0x20, 0x86, 0x5B, 0xCF, 0x65, 0xE6, 0x2D, 0xA8, 0x02,
+			0x1B, 0x60, 0x25, 0xAD, 0xAE, 0xB0, 0xB9, 0xF6, 0x1C, 0x46, 0x61, 0x69, 0x34, 0x40, 0x7E, 0x0F,
+			0x55, 0x47, 0xA3, 0x23, 0xDD, 0x51, 0xAF, 0x3A, 0xC3, 0x5C, 0xF9, 0xCE, 0xBA, 0xC5, 0xEA, 0x26,
+			0x2C, 0x53, 0x0D, 0x6E, 0x85, 0x28, 0x84, 0x09, 0xD3, 0xDF, 0xCD, 0xF4, 0x41, 0x81, 0x4D, 0x52,
+			0x6A, 0xDC, 0x37, 0xC8, 0x6C, 0xC1, 0xAB, 0xFA, 0x24, 0xE1, 0x7B, 0x08, 0x0C, 0xBD, 0xB1, 0x4A,
+			0x78, 0x88, 0x95, 0x8B, 0xE3, 0x63, 0xE8, 0x6D, 0xE9, 0xCB, 0xD5, 0xFE, 0x3B, 0x00, 0x1D, 0x39,
+			0xF2, 0xEF, 0xB7, 0x0E, 0x66, 0x58, 0xD0, 0xE4, 0xA6, 0x77, 0x72, 0xF8, 0xEB, 0x75, 0x4B, 0x0A,
+			0x31, 0x44, 0x50, 0xB4, 0x8F, 0xED, 0x1F, 0x1A, 0xDB, 0x99, 0x8D, 0x33, 0x9F, 0x11, 0x83, 0x14
+		};
 
-			// algorithm-defined constants
-			const uint32_t A = 0x67452301;
-			const uint32_t B = 0xefcdab89;
-			const uint32_t C = 0x98badcfe;
-			const uint32_t D = 0x10325476;
+		// portable MD2 compression of 'blocks' consecutive 16-byte blocks into the
+		// 48-byte state 'x', also folding each block into the checksum 'c'
+		//
+		// each block is an 18 x 48 chain of dependent S-table lookups, so a single
+		// message cannot go faster than the lookup latency; throughput comes from
+		// interleaving several messages (see md2_interleaved)
+		inline void md2_generic(uint8_t x[48], uint8_t c[16], const uint8_t* data, size_t blocks) {
+			uint8_t s[48], sum[16];
+			memcpy(s, x, sizeof(s));
+			memcpy(sum, c, sizeof(sum));
+
+			for (; blocks != 0; --blocks, data += 16) {
+				for (uint32_t j = 0; j < 16; ++j) {
+					s[j + 16] = data[j];
+					s[j + 32] = data[j] ^ s[j];
+				}
+
+				uint8_t t = 0;
+				for (uint32_t j = 0; j < 18; ++j) {
+					for (uint32_t k = 0; k < 48; ++k) {
+						t = s[k] ^= MD2_S[t];
+					}
+					t = static_cast<uint8_t>(t + j);
+				}
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+				t = sum[15];
+				for (uint32_t j = 0; j < 16; ++j) {
+					t = sum[j] ^= MD2_S[data[j] ^ t];
+				}
+			}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+			memcpy(x, s, sizeof(s));
+			memcpy(c, sum, sizeof(sum));
+		}
 
-			// private class methods
-		private:
-			// initialize our context for this hash function
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint32_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+		// MD2 compression of one 16-byte block from each of _Lanes independent
+		// messages, stepping every lane's lookup chain in turn so that the lookups
+		// of different lanes overlap; the state, checksum and input are byte-sliced
+		// (byte i of lane l at [i * _Lanes + l], see md2_multibuffer)
+		template <size_t _Lanes>
+		inline void md2_interleaved(uint8_t* x, uint8_t* c, const uint8_t* in) {
+			uint8_t t[_Lanes] = { 0 };
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+			for (size_t j = 0; j < 16; ++j) {
+				for (size_t l = 0; l < _Lanes; ++l) {
+					x[(j + 16) * _Lanes + l] = in[j * _Lanes + l];
+					x[(j + 32) * _Lanes + l] = in[j * _Lanes + l] ^ x[j * _Lanes + l];
+				}
+			}
 
-			// auxiliary functions defined by the algorithm
-			// as per: http://practicalcryptography.com/hashes/md4-hash/
-			constexpr uint32_t F(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t G(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t H(const uint32_t B, const uint32_t C, const uint32_t D);
+			for (size_t j = 0; j < 18; ++j) {
+				for (size_t k = 0; k < 48; ++k) {
+					for (size_t l = 0; l < _Lanes; ++l) {
+						t[l] = x[k * _Lanes + l] ^= MD2_S[t[l]];
+					}
+				}
+				for (size_t l = 0; l < _Lanes; ++l) {
+					t[l] = static_cast<uint8_t>(t[l] + j);
+				}
+			}
 
-			// round functions
-			constexpr void R1(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s);
-			constexpr void R2(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s);
-			constexpr void R3(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s);
-		};
-		class MD2 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 16);
+			for (size_t l = 0; l < _Lanes; ++l) {
+				t[l] = c[15 * _Lanes + l];
+			}
+			for (size_t j = 0; j < 16; ++j) {
+				for (size_t l = 0; l < _Lanes; ++l) {
+					t[l] = c[j * _Lanes + l] ^= MD2_S[in[j * _Lanes + l] ^ t[l]];
+				}
 			}
+		}
 
-			// private members
-		private:
-			const uint8_t BLOCK_SIZE = 16, DIGEST_SIZE = 16;
+		// SHA-1 round constants (K) and initial hash values (H)
+		// as per: https://datatracker.ietf.org/doc/html/rfc3174
+		inline constexpr uint32_t SHA1_K[4] = {
+			0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6
+		};
+		inline constexpr uint32_t SHA1_H[5] = {
+			0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+		};
 
-			typedef struct {
-				uint8_t buf[16], state[48], checksum[16], digest[16];
-				uint64_t size;
-			} CTX;
+		// block and length-encoding layout of the SHA-1 compression
+		struct sha1_traits {
+			typedef uint32_t word;
+			static constexpr size_t WORDS = 5, BLOCK = 64, LENGTH = 8;
+			static constexpr bool MSB_FIRST = true;
+		};
 
-			CTX context = { 0 };
+		// expands the SHA-1 message schedule of the 64-byte block 'data'
+		constexpr void sha1_schedule(uint32_t w[80], const uint8_t* data) noexcept {
+			for (uint32_t i = 0; i < 16; ++i) {
+				w[i] = (static_cast<uint32_t>(data[i * 4]) << 24) | (static_cast<uint32_t>(data[i * 4 + 1]) << 16) |
+					(static_cast<uint32_t>(data[i * 4 + 2]) << 8) | static_cast<uint32_t>(data[i * 4 + 3]);
+			}
+			for (uint32_t i = 16; i < 80; ++i) {
+				const uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+				w[i] = (x << 1) | (x >> 31);
+			}
+		}
 
-			// S-table values for MD2 algorithm 
-			// as per: https://en.wikipedia.org/wiki/MD2_(hash_function)#Description
-			const uint8_t S[256] = {
-				0x29, 0x2E, 0x43, 0xC9, 0xA2, 0xD8, 0x7C, 0x01, 0x3D, 0x36, 0x54, 0xA1, 0xEC, 0xF0, 0x06, 0x13,
-				0x62, 0xA7, 0x05, 0xF3, 0xC0, 0xC7, 0x73, 0x8C, 0x98, 0x93, 0x2B, 0xD9, 0xBC, 0x4C, 0x82, 0xCA,
-				0x1E, 0x9B, 0x57, 0x3C, 0xFD, 0xD4, 0xE0, 0x16, 0x67, 0x42, 0x6F, 0x18, 0x8A, 0x17, 0xE5, 0x12,
-				0xBE, 0x4E, 0xC4, 0xD6, 0xDA, 0x9E, 0xDE, 0x49, 0xA0, 0xFB, 0xF5, 0x8E, 0xBB, 0x2F, 0xEE, 0x7A,
-				0xA9, 0x68, 0x79, 0x91, 0x15, 0xB2, 0x07, 0x3F, 0x94, 0xC2, 0x10, 0x89, 0x0B, 0x22, 0x5F, 0x21,
-				0x80, 0x7F, 0x5D, 0x9A, 0x5A, 0x90, 0x32, 0x27, 0x35, 0x3E, 0xCC, 0xE7, 0xBF, 0xF7, 0x97, 0x03,
-				0xFF, 0x19, 0x30, 0xB3, 0x48, 0xA5, 0xB5, 0xD1, 0xD7, 0x5E, 0x92, 0x2A, 0xAC, 0x56, 0xAA, 0xC6,
-				0x4F, 0xB8, 0x38, 0xD2, 0x96, 0xA4, 0x7D, 0xB6, 0x76, 0xFC, 0x6B, 0xE2, 0x9C, 0x74, 0x04, 0xF1,
-				0x45, 0x9D, 0x70, 0x59, 0x64, 0x71, 0x87, 0x20, 0x86, 0x5B, 0xCF, 0x65, 0xE6, 0x2D, 0xA8, 0x02,
-				0x1B, 0x60, 0x25, 0xAD, 0xAE, 0xB0, 0xB9, 0xF6, 0x1C, 0x46, 0x61, 0x69, 0x34, 0x40, 0x7E, 0x0F,
-				0x55, 0x47, 0xA3, 0x23, 0xDD, 0x51, 0xAF, 0x3A, 0xC3, 0x5C, 0xF9, 0xCE, 0xBA, 0xC5, 0xEA, 0x26,
-				0x2C, 0x53, 0x0D, 0x6E, 0x85, 0x28, 0x84, 0x09, 0xD3, 0xDF, 0xCD, 0xF4, 0x41, 0x81, 0x4D, 0x52,
-				0x6A, 0xDC, 0x37, 0xC8, 0x6C, 0xC1, 0xAB, 0xFA, 0x24, 0xE1, 0x7B, 0x08, 0x0C, 0xBD, 0xB1, 0x4A,
-				0x78, 0x88, 0x95, 0x8B, 0xE3, 0x63, 0xE8, 0x6D, 0xE9, 0xCB, 0xD5, 0xFE, 0x3B, 0x00, 0x1D, 0x39,
-				0xF2, 0xEF, 0xB7, 0x0E, 0x66, 0x58, 0xD0, 0xE4, 0xA6, 0x77, 0x72, 0xF8, 0xEB, 0x75, 0x4B, 0x0A,
-				0x31, 0x44, 0x50, 0xB4, 0x8F, 0xED, 0x1F, 0x1A, 0xDB, 0x99, 0x8D, 0x33, 0x9F, 0x11, 0x83, 0x14
-			};
+		// portable SHA-1 rounds over an expanded message schedule
+		inline void sha1_rounds(uint32_t state[5], const uint32_t w[80]) noexcept {
+			auto rl = [](uint32_t x, uint32_t y) { return (x << y) | (x >> (32 - y)); };
+			uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+			for (uint32_t i = 0; i < 80; ++i) {
+				uint32_t f, k;
+				if (i < 20) {
+					f = d ^ (b & (c ^ d)); k = 0x5a827999;
+				}
+				else if (i < 40) {
+					f = b ^ c ^ d; k = 0x6ed9eba1;
+				}
+				else if (i < 60) {
+					f = (b & c) | (d & (b | c)); k = 0x8f1bbcdc;
+				}
+				else {
+					f = b ^ c ^ d; k = 0xca62c1d6;
+				}
+				const uint32_t t = rl(a, 5) + f + e + k + w[i];
+				e = d; d = c; c = rl(b, 30); b = a; a = t;
+			}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+			state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e;
+		}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+		// portable SHA-1 compression of 'blocks' consecutive 64-byte blocks
+		inline void sha1_generic(uint32_t state[5], const uint8_t* data, size_t blocks) {
+			for (; blocks != 0; --blocks, data += 64) {
+				uint32_t w[80];
+				sha1_schedule(w, data);
+				sha1_rounds(state, w);
+			}
+		}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		// SHA-256 round constants (K) as per: https://datatracker.ietf.org/doc/html/rfc6234
+		alignas(64) inline constexpr uint32_t SHA256_K[64] = {
+			0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+			0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+			0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+			0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+			0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+			0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+			0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+			0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+			0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+			0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+			0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+			0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+			0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+			0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+			0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+			0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 		};
 
-		// MD5
-		inline void hashpp::MD::MD5::ctx_init() {
-			this->context = {
-				0,
-				{this->A, this->B, this->C, this->D}
-			};
+		// SHA2-224 and SHA2-256 initial hash values (H) as per: https://datatracker.ietf.org/doc/html/rfc6234
+		inline constexpr uint32_t SHA224_H[8] = {
+			0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+			0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+		};
+		inline constexpr uint32_t SHA256_H[8] = {
+			0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+			0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+		};
+
+		// block and length-encoding layout of the SHA2-224/SHA2-256 compression
+		// for the multibuffer driver below
+		struct sha256_traits {
+			typedef uint32_t word;
+			static constexpr size_t WORDS = 8, BLOCK = 64, LENGTH = 8;
+			static constexpr bool MSB_FIRST = true;
+		};
+
+		// expands the SHA-256 message schedule of the 64-byte block 'data'
+		constexpr void sha256_schedule(uint32_t w[64], const uint8_t* data) noexcept {
+			auto rr = [](uint32_t x, uint32_t y) { return (x >> y) | (x << (32 - y)); };
+
+			for (uint32_t i = 0; i < 16; ++i) {
+				w[i] = (static_cast<uint32_t>(data[i * 4]) << 24) | (static_cast<uint32_t>(data[i * 4 + 1]) << 16) |
+					(static_cast<uint32_t>(data[i * 4 + 2]) << 8) | static_cast<uint32_t>(data[i * 4 + 3]);
+			}
+			for (uint32_t i = 16; i < 64; ++i) {
+				w[i] = (rr(w[i - 2], 17) ^ rr(w[i - 2], 19) ^ (w[i - 2] >> 10)) + w[i - 7] +
+					(rr(w[i - 15], 7) ^ rr(w[i - 15], 18) ^ (w[i - 15] >> 3)) + w[i - 16];
+			}
 		}
-		inline void hashpp::MD::MD5::ctx_transform(const uint32_t* data) {
-			uint32_t results[4] = {
-				this->context.buf[0], // a0
-				this->context.buf[1], // b0
-				this->context.buf[2], // c0
-				this->context.buf[3]  // d0
-			};
 
-			uint32_t E, j, t;
+		// portable SHA-256 rounds over an expanded message schedule
+		inline void sha256_rounds(uint32_t state[8], const uint32_t w[64]) noexcept {
+			auto rr = [](uint32_t x, uint32_t y) { return (x >> y) | (x << (32 - y)); };
+			uint32_t r[8];
+
+			memcpy(r, state, sizeof(r));
 			for (uint32_t i = 0; i < 64; ++i) {
-				switch (i / 16) {
-				case 0:
-				{
-					E = this->F(results[1], results[2], results[3]);
-					j = i;
-					break;
-				}
-				case 1:
-				{
-					E = this->G(results[1], results[2], results[3]);
-					j = ((i * 5) + 1) % 16;
-					break;
-				}
-				case 2:
-				{
-					E = this->H(results[1], results[2], results[3]);
-					j = ((i * 3) + 5) % 16;
-					break;
-				}
-				default:
-				{
-					E = this->I(results[1], results[2], results[3]);
-					j = (i * 7) % 16;
-					break;
-				}
-				}
+				uint32_t t1 = r[7] + (rr(r[4], 6) ^ rr(r[4], 11) ^ rr(r[4], 25)) + ((r[4] & r[5]) ^ (~r[4] & r[6])) + SHA256_K[i] + w[i];
+				uint32_t t2 = (rr(r[0], 2) ^ rr(r[0], 13) ^ rr(r[0], 22)) + ((r[0] & r[1]) ^ (r[0] & r[2]) ^ (r[1] & r[2]));
+				r[7] = r[6]; r[6] = r[5]; r[5] = r[4]; r[4] = r[3] + t1;
+				r[3] = r[2]; r[2] = r[1]; r[1] = r[0]; r[0] = t1 + t2;
+			}
+			for (uint32_t i = 0; i < 8; ++i) {
+				state[i] += r[i];
+			}
+		}
 
-				t = results[3];
-				results[3] = results[2]; results[2] = results[1];
-				results[1] = results[1] + this->rl32(results[0] + E + K[i] + data[j], S[i]);
-				results[0] = t;
+		// portable SHA-256 compression of 'blocks' consecutive 64-byte blocks
+		inline void sha256_generic(uint32_t state[8], const uint8_t* data, size_t blocks) {
+			for (; blocks != 0; --blocks, data += 64) {
+				uint32_t w[64];
+				sha256_schedule(w, data);
+				sha256_rounds(state, w);
 			}
+		}
+
+		// SHA-512 round constants (K) as per: https://datatracker.ietf.org/doc/html/rfc6234
+		alignas(64) inline constexpr uint64_t SHA512_K[80] = {
+			0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+			0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+			0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+			0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+			0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+			0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+			0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+			0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+			0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+			0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+			0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+			0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+			0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+			0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+			0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+			0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+			0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+			0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+			0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+			0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+		};
+
+		// SHA2-384, SHA2-512, SHA2-512/224 and SHA2-512/256 initial hash values (H)
+		// as per: https://datatracker.ietf.org/doc/html/rfc6234 and FIPS 180-4
+		inline constexpr uint64_t SHA384_H[8] = {
+			0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17, 0x152fecd8f70e5939,
+			0x67332667ffc00b31, 0x8eb44a8768581511, 0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4
+		};
+		inline constexpr uint64_t SHA512_H[8] = {
+			0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+			0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+		};
+		inline constexpr uint64_t SHA512_224_H[8] = {
+			0x8c3d37c819544da2, 0x73e1996689dcd4d6, 0x1dfab7ae32ff9c82, 0x679dd514582f9fcf,
+			0x0f6d2b697bd44da8, 0x77e36f7304c48942, 0x3f9d85a86a1d36c8, 0x1112e6ad91d692a1
+		};
+		inline constexpr uint64_t SHA512_256_H[8] = {
+			0x22312194fc2bf72c, 0x9f555fa3c84c64c2, 0x2393b86b6f53b151, 0x963877195940eabd,
+			0x96283ee2a88effe3, 0xbe5e1e2553863992, 0x2b0199fc2c85b8aa, 0x0eb72ddc81c52ca2
+		};
+
+		// block and length-encoding layout of the SHA2-384/SHA2-512 family
+		// compression (the truncated variants differ only in IV and digest size)
+		struct sha512_traits {
+			typedef uint64_t word;
+			static constexpr size_t WORDS = 8, BLOCK = 128, LENGTH = 16;
+			static constexpr bool MSB_FIRST = true;
+		};
 
-			for (uint32_t z = 0; z < 4; z++) {
-				this->context.buf[z] += results[z];
+		// expands the SHA-512 message schedule of the 128-byte block 'data'
+		constexpr void sha512_schedule(uint64_t w[80], const uint8_t* data) noexcept {
+			auto rr = [](uint64_t x, uint64_t y) { return (x >> y) | (x << (64 - y)); };
+
+			for (uint32_t i = 0; i < 16; ++i) {
+				GU64B(w[i], data, 8 * i);
+			}
+			for (uint32_t i = 16; i < 80; ++i) {
+				w[i] = (rr(w[i - 2], 19) ^ rr(w[i - 2], 61) ^ (w[i - 2] >> 6)) + w[i - 7] +
+					(rr(w[i - 15], 1) ^ rr(w[i - 15], 8) ^ (w[i - 15] >> 7)) + w[i - 16];
 			}
 		}
-		inline void hashpp::MD::MD5::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t input[16], offset = this->context.size % 64;
-			this->context.size += static_cast<uint64_t>(len);
 
-			for (uint32_t i = 0; i < len; ++i) {
-				this->context.in[offset++] = static_cast<uint8_t>(*(data + i));
+		// portable SHA-512 rounds over an expanded message schedule
+		inline void sha512_rounds(uint64_t state[8], const uint64_t w[80]) noexcept {
+			auto rr = [](uint64_t x, uint64_t y) { return (x >> y) | (x << (64 - y)); };
+			uint64_t r[8];
 
-				if (offset % 64 == 0) {
-					for (uint32_t j = 0; j < 16; ++j) {
-						input[j] = static_cast<uint32_t>(this->context.in[(j * 4) + 3]) << 24 |
-							static_cast<uint32_t>(this->context.in[(j * 4) + 2]) << 16 |
-							static_cast<uint32_t>(this->context.in[(j * 4) + 1]) << 8 |
-							static_cast<uint32_t>(this->context.in[(j * 4)]);
-					}
-					this->ctx_transform(input);
-					offset = 0;
-				}
+			memcpy(r, state, sizeof(r));
+			for (uint32_t i = 0; i < 80; ++i) {
+				uint64_t t1 = r[7] + (rr(r[4], 14) ^ rr(r[4], 18) ^ rr(r[4], 41)) + ((r[4] & r[5]) ^ (~r[4] & r[6])) + SHA512_K[i] + w[i];
+				uint64_t t2 = (rr(r[0], 28) ^ rr(r[0], 34) ^ rr(r[0], 39)) + ((r[0] & r[1]) ^ (r[0] & r[2]) ^ (r[1] & r[2]));
+				r[7] = r[6]; r[6] = r[5]; r[5] = r[4]; r[4] = r[3] + t1;
+				r[3] = r[2]; r[2] = r[1]; r[1] = r[0]; r[0] = t1 + t2;
+			}
+			for (uint32_t i = 0; i < 8; ++i) {
+				state[i] += r[i];
 			}
 		}
-		inline void hashpp::MD::MD5::ctx_final() {
-			uint32_t input[16];
-			uint32_t offset = this->context.size % 64;
-			uint32_t plen = offset < 56 ? 56 - offset : (56 + 64) - offset;
 
-			this->ctx_update(this->pad, plen);
-			this->context.size -= static_cast<uint64_t>(plen);
+		// portable SHA-512 compression of 'blocks' consecutive 128-byte blocks
+		inline void sha512_generic(uint64_t state[8], const uint8_t* data, size_t blocks) {
+			for (; blocks != 0; --blocks, data += 128) {
+				uint64_t w[80];
+				sha512_schedule(w, data);
+				sha512_rounds(state, w);
+			}
+		}
+
+		// Keccak-f[1600] round constants (iota)
+		// as per: https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.202.pdf
+		alignas(64) inline constexpr uint64_t KECCAK_RC[24] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+			0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+			0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// little-endian load of one Keccak lane
+		constexpr uint64_t keccak_lane(const uint8_t* p) noexcept {
+			return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8) | (static_cast<uint64_t>(p[2]) << 16) |
+				(static_cast<uint64_t>(p[3]) << 24) | (static_cast<uint64_t>(p[4]) << 32) | (static_cast<uint64_t>(p[5]) << 40) |
+				(static_cast<uint64_t>(p[6]) << 48) | (static_cast<uint64_t>(p[7]) << 56);
+		}
+
+#define HASHPP_ROL64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+// one Keccak-f[1600] round from the lanes A## into the lanes E## (theta, rho, pi, chi
+// and iota together), lanes being named by row (b, g, k, m, s) and column (a, e, i, o, u);
+// the lanes be, bi, go, ki, mi and sa are held complemented, which leaves a single NOT
+// in each row of chi
+#define HASHPP_KECCAK_ROUND(A, E, rc) do {									\
+	Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa;								\
+	Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se;								\
+	Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si;								\
+	Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so;								\
+	Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su;								\
+	Da = Cu ^ HASHPP_ROL64(Ce, 1); De = Ca ^ HASHPP_ROL64(Ci, 1); Di = Ce ^ HASHPP_ROL64(Co, 1);		\
+	Do = Ci ^ HASHPP_ROL64(Cu, 1); Du = Co ^ HASHPP_ROL64(Ca, 1);						\
+	Bba = A##ba ^ Da; Bbe = HASHPP_ROL64(A##ge ^ De, 44); Bbi = HASHPP_ROL64(A##ki ^ Di, 43);		\
+	Bbo = HASHPP_ROL64(A##mo ^ Do, 21); Bbu = HASHPP_ROL64(A##su ^ Du, 14);					\
+	E##ba = Bba ^ (Bbe | Bbi) ^ (rc); E##be = Bbe ^ (~Bbi | Bbo); E##bi = Bbi ^ (Bbo & Bbu);		\
+	E##bo = Bbo ^ (Bbu | Bba); E##bu = Bbu ^ (Bba & Bbe);							\
+	Bga = HASHPP_ROL64(A##bo ^ Do, 28); Bge = HASHPP_ROL64(A##gu ^ Du, 20); Bgi = HASHPP_ROL64(A##ka ^ Da, 3);	\
+	Bgo = HASHPP_ROL64(A##me ^ De, 45); Bgu = HASHPP_ROL64(A##si ^ Di, 61);					\
+	E##ga = Bga ^ (Bge | Bgi); E##ge = Bge ^ (Bgi & Bgo); E##gi = Bgi ^ (Bgo | ~Bgu);			\
+	E##go = Bgo ^ (Bgu | Bga); E##gu = Bgu ^ (Bga & Bge);							\
+	Bka = HASHPP_ROL64(A##be ^ De, 1); Bke = HASHPP_ROL64(A##gi ^ Di, 6); Bki = HASHPP_ROL64(A##ko ^ Do, 25);	\
+	Bko = HASHPP_ROL64(A##mu ^ Du, 8); Bku = HASHPP_ROL64(A##sa ^ Da, 18);					\
+	E##ka = Bka ^ (Bke | Bki); E##ke = Bke ^ (Bki & Bko); E##ki = Bki ^ (~Bko & Bku);			\
+	E##ko = ~Bko ^ (Bku | Bka); E##ku = Bku ^ (Bka & Bke);							\
+	Bma = HASHPP_ROL64(A##bu ^ Du, 27); Bme = HASHPP_ROL64(A##ga ^ Da, 36); Bmi = HASHPP_ROL64(A##ke ^ De, 10); \
+	Bmo = HASHPP_ROL64(A##mi ^ Di, 15); Bmu = HASHPP_ROL64(A##so ^ Do, 56);					\
+	E##ma = Bma ^ (Bme & Bmi); E##me = Bme ^ (Bmi | Bmo); E##mi = Bmi ^ (~Bmo | Bmu);			\
+	E##mo = ~Bmo ^ (Bmu & Bma); E##mu = Bmu ^ (Bma | Bme);							\
+	Bsa = HASHPP_ROL64(A##bi ^ Di, 62); Bse = HASHPP_ROL64(A##go ^ Do, 55); Bsi = HASHPP_ROL64(A##ku ^ Du, 39); \
+	Bso = HASHPP_ROL64(A##ma ^ Da, 41); Bsu = HASHPP_ROL64(A##se ^ De, 2);					\
+	E##sa = Bsa ^ (~Bse & Bsi); E##se = ~Bse ^ (Bsi | Bso); E##si = Bsi ^ (Bso & Bsu);			\
+	E##so = Bso ^ (Bsu | Bsa); E##su = Bsu ^ (Bsa & Bse);							\
+} while(0)
+
+#define HASHPP_KECCAK_XOR(l, i) do {					\
+	if (rate > 8 * (i)) {						\
+		(l) ^= keccak_lane(data + 8 * (i));			\
+	}								\
+} while(0)
+
+// absorbs 'blocks' consecutive blocks of 'rate' bytes into the Keccak state 'st', permuting
+// after each; all 24 rounds are unrolled and the state stays in locals between blocks,
+// alternating between the A and E lanes every round rather than being copied back
+#define HASHPP_KECCAK_ABSORB() do {									\
+	uint64_t Aba = st[0], Abe = ~st[1], Abi = ~st[2], Abo = st[3], Abu = st[4],			\
+		Aga = st[5], Age = st[6], Agi = st[7], Ago = ~st[8], Agu = st[9],			\
+		Aka = st[10], Ake = st[11], Aki = ~st[12], Ako = st[13], Aku = st[14],			\
+		Ama = st[15], Ame = st[16], Ami = ~st[17], Amo = st[18], Amu = st[19],			\
+		Asa = ~st[20], Ase = st[21], Asi = st[22], Aso = st[23], Asu = st[24];			\
+	uint64_t Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki, Eko, Eku;		\
+	uint64_t Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;					\
+	uint64_t Bba, Bbe, Bbi, Bbo, Bbu, Bga, Bge, Bgi, Bgo, Bgu, Bka, Bke, Bki, Bko, Bku;		\
+	uint64_t Bma, Bme, Bmi, Bmo, Bmu, Bsa, Bse, Bsi, Bso, Bsu;					\
+	uint64_t Ca, Ce, Ci, Co, Cu, Da, De, Di, Do, Du;						\
+													\
+	for (; blocks != 0; --blocks, data += rate) {							\
+		HASHPP_KECCAK_XOR(Aba, 0); HASHPP_KECCAK_XOR(Abe, 1); HASHPP_KECCAK_XOR(Abi, 2);	\
+		HASHPP_KECCAK_XOR(Abo, 3); HASHPP_KECCAK_XOR(Abu, 4);					\
+		HASHPP_KECCAK_XOR(Aga, 5); HASHPP_KECCAK_XOR(Age, 6); HASHPP_KECCAK_XOR(Agi, 7);	\
+		HASHPP_KECCAK_XOR(Ago, 8); HASHPP_KECCAK_XOR(Agu, 9);					\
+		HASHPP_KECCAK_XOR(Aka, 10); HASHPP_KECCAK_XOR(Ake, 11); HASHPP_KECCAK_XOR(Aki, 12);	\
+		HASHPP_KECCAK_XOR(Ako, 13); HASHPP_KECCAK_XOR(Aku, 14);					\
+		HASHPP_KECCAK_XOR(Ama, 15); HASHPP_KECCAK_XOR(Ame, 16); HASHPP_KECCAK_XOR(Ami, 17);	\
+		HASHPP_KECCAK_XOR(Amo, 18); HASHPP_KECCAK_XOR(Amu, 19);					\
+		HASHPP_KECCAK_XOR(Asa, 20); HASHPP_KECCAK_XOR(Ase, 21); HASHPP_KECCAK_XOR(Asi, 22);	\
+		HASHPP_KECCAK_XOR(Aso, 23); HASHPP_KECCAK_XOR(Asu, 24);					\
+													\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[0]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[1]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[2]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[3]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[4]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[5]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[6]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[7]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[8]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[9]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[10]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[11]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[12]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[13]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[14]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[15]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[16]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[17]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[18]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[19]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[20]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[21]);	\
+		HASHPP_KECCAK_ROUND(A, E, KECCAK_RC[22]); HASHPP_KECCAK_ROUND(E, A, KECCAK_RC[23]);	\
+	}												\
+													\
+	st[0] = Aba; st[1] = ~Abe; st[2] = ~Abi; st[3] = Abo; st[4] = Abu;				\
+	st[5] = Aga; st[6] = Age; st[7] = Agi; st[8] = ~Ago; st[9] = Agu;				\
+	st[10] = Aka; st[11] = Ake; st[12] = ~Aki; st[13] = Ako; st[14] = Aku;				\
+	st[15] = Ama; st[16] = Ame; st[17] = ~Ami; st[18] = Amo; st[19] = Amu;				\
+	st[20] = ~Asa; st[21] = Ase; st[22] = Asi; st[23] = Aso; st[24] = Asu;				\
+} while(0)
+
+		// portable Keccak-f[1600] absorb of 'blocks' blocks of 'rate' bytes (a whole number of
+		// lanes); with a rate of 0, 'st' is simply permuted 'blocks' times
+		inline void keccak_generic(uint64_t st[25], const uint8_t* data, size_t blocks, size_t rate) noexcept {
+			HASHPP_KECCAK_ABSORB();
+		}
+
+#if defined(HASHPP_X86)
+		// the same with the rotates as three-operand BMI2 rorx, sparing a register copy for
+		// each of the 29 rotates per round that keep their source live
+		HASHPP_TARGET("bmi2")
+		inline void keccak_bmi2(uint64_t st[25], const uint8_t* data, size_t blocks, size_t rate) noexcept {
+			HASHPP_KECCAK_ABSORB();
+		}
+#endif
 
-			for (uint32_t j = 0; j < 14; ++j) {
-				input[j] = static_cast<uint32_t>(this->context.in[(j * 4) + 3]) << 24 |
-					static_cast<uint32_t>(this->context.in[(j * 4) + 2]) << 16 |
-					static_cast<uint32_t>(this->context.in[(j * 4) + 1]) << 8 |
-					static_cast<uint32_t>(this->context.in[(j * 4)]);
+#undef HASHPP_KECCAK_ABSORB
+#undef HASHPP_KECCAK_XOR
+#undef HASHPP_KECCAK_ROUND
+#undef HASHPP_ROL64
+
+		// writes the first 'len' bytes of the Keccak state 'st' (its lanes in little-endian
+		// order) to 'out'; each whole lane is written as eight byte stores of one word, which
+		// compilers merge into a single store
+		inline void keccak_extract(const uint64_t st[25], uint8_t* out, size_t len) noexcept {
+			size_t i = 0;
+			for (; i + 8 <= len; i += 8) {
+				const uint64_t v = st[i / 8];
+				out[i] = static_cast<uint8_t>(v); out[i + 1] = static_cast<uint8_t>(v >> 8);
+				out[i + 2] = static_cast<uint8_t>(v >> 16); out[i + 3] = static_cast<uint8_t>(v >> 24);
+				out[i + 4] = static_cast<uint8_t>(v >> 32); out[i + 5] = static_cast<uint8_t>(v >> 40);
+				out[i + 6] = static_cast<uint8_t>(v >> 48); out[i + 7] = static_cast<uint8_t>(v >> 56);
+			}
+			for (; i < len; ++i) {
+				out[i] = static_cast<uint8_t>(st[i / 8] >> (8 * (i % 8)));
 			}
-			input[14] = static_cast<uint32_t>(this->context.size * 8);
-			input[15] = static_cast<uint32_t>((this->context.size * 8) >> 32);
+		}
 
-			this->ctx_transform(input);
+		// BLAKE2 message word permutations (sigma), BLAKE2b's last two rounds reusing the first
+		// two; BLAKE2b and BLAKE2s start from the SHA-512 and SHA-256 initial values respectively
+		// as per: https://datatracker.ietf.org/doc/html/rfc7693
+		alignas(64) inline constexpr uint8_t BLAKE2_SIGMA[12][16] = {
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+			{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+			{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+			{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+			{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+			{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+			{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+			{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+			{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+			{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+			{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+		};
 
-			for (uint32_t i = 0; i < 4; ++i) {
-				this->context.digest[(i * 4) + 0] = static_cast<uint8_t>((this->context.buf[i] & 0x000000FF));
-				this->context.digest[(i * 4) + 1] = static_cast<uint8_t>((this->context.buf[i] & 0x0000FF00) >> 8);
-				this->context.digest[(i * 4) + 2] = static_cast<uint8_t>((this->context.buf[i] & 0x00FF0000) >> 16);
-				this->context.digest[(i * 4) + 3] = static_cast<uint8_t>((this->context.buf[i] & 0xFF000000) >> 24);
+		// little-endian load of one BLAKE2 message word
+		template <class _Word>
+		constexpr _Word blake2_word(const uint8_t* p) noexcept {
+			_Word w = 0;
+			for (size_t i = 0; i < sizeof(_Word); ++i) {
+				w |= static_cast<_Word>(p[i]) << (8 * i);
 			}
+			return w;
 		}
-		inline std::string MD5::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+
+// the BLAKE2 mixing function G on the words v[a], v[b], v[c] and v[d] of the working
+// vector, with message words x and y and rotate amounts r1 to r4
+#define HASHPP_BLAKE2_G(a, b, c, d, x, y, r1, r2, r3, r4) do {							\
+	v[a] = v[a] + v[b] + (x); v[d] = HASHPP_ROR(v[d] ^ v[a], r1);						\
+	v[c] = v[c] + v[d]; v[b] = HASHPP_ROR(v[b] ^ v[c], r2);							\
+	v[a] = v[a] + v[b] + (y); v[d] = HASHPP_ROR(v[d] ^ v[a], r3);						\
+	v[c] = v[c] + v[d]; v[b] = HASHPP_ROR(v[b] ^ v[c], r4);							\
+} while(0)
+#define HASHPP_ROR(x, n) (((x) >> (n)) | ((x) << (8 * sizeof(_Word) - (n))))
+
+		// BLAKE2 round _R, its message permutation fixed at compile time
+		template <class _Word, size_t _R>
+		inline void blake2_round(_Word v[16], const _Word m[16]) noexcept {
+			constexpr unsigned r1 = sizeof(_Word) == 8 ? 32 : 16, r2 = sizeof(_Word) == 8 ? 24 : 12;
+			constexpr unsigned r3 = sizeof(_Word) == 8 ? 16 : 8, r4 = sizeof(_Word) == 8 ? 63 : 7;
+			constexpr const uint8_t* s = BLAKE2_SIGMA[_R];
+
+			HASHPP_BLAKE2_G(0, 4, 8, 12, m[s[0]], m[s[1]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(1, 5, 9, 13, m[s[2]], m[s[3]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(2, 6, 10, 14, m[s[4]], m[s[5]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(3, 7, 11, 15, m[s[6]], m[s[7]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(0, 5, 10, 15, m[s[8]], m[s[9]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(1, 6, 11, 12, m[s[10]], m[s[11]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(2, 7, 8, 13, m[s[12]], m[s[13]], r1, r2, r3, r4);
+			HASHPP_BLAKE2_G(3, 4, 9, 14, m[s[14]], m[s[15]], r1, r2, r3, r4);
 		}
-		inline std::string MD5::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[64] = {0};
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
-				}
+		template <class _Word, size_t... _R>
+		inline void blake2_rounds(_Word v[16], const _Word m[16], std::index_sequence<_R...>) noexcept {
+			(blake2_round<_Word, _R>(v, m), ...);
+		}
+
+		// portable BLAKE2 compression of 'blocks' consecutive blocks of sixteen words, 'counter'
+		// bytes having been compressed before the first; with 'last' set, the last of them is
+		// compressed as the final block of the message. BLAKE2b (_Rounds = 12) counts up to
+		// 2^128 bytes, of which only the low 64 bits are kept here; the rounds are unrolled
+		// at compile time
+		template <class _Word, size_t _Rounds>
+		inline void blake2_generic(_Word h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) noexcept {
+			const _Word* iv = nullptr;
+			if constexpr (sizeof(_Word) == 8) {
+				iv = SHA512_H;
 			}
 			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
-				}
-			}
-
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
+				iv = SHA256_H;
 			}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
-			}
+			for (; blocks != 0; --blocks, data += 16 * sizeof(_Word)) {
+				_Word m[16], v[16];
+				for (size_t i = 0; i < 16; ++i) {
+					m[i] = blake2_word<_Word>(data + i * sizeof(_Word));
+				}
+				counter += 16 * sizeof(_Word);
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+				for (size_t i = 0; i < 8; ++i) {
+					v[i] = h[i];
+					v[i + 8] = iv[i];
+				}
+				v[12] ^= static_cast<_Word>(counter);
+				if constexpr (sizeof(_Word) == 4) {
+					v[13] ^= static_cast<_Word>(counter >> 32);
+				}
+				if (last && blocks == 1) {
+					v[14] = ~v[14];
+				}
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
-			}
+				blake2_rounds(v, m, std::make_index_sequence<_Rounds>());
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+				for (size_t i = 0; i < 8; ++i) {
+					h[i] ^= v[i] ^ v[i + 8];
+				}
 			}
+		}
 
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		// BLAKE3 message word order in each of its seven rounds (each round permuting the last),
+		// and the domain separation flags of its compressions; BLAKE3 also starts from the
+		// SHA-256 initial values
+		// as per: https://github.com/BLAKE3-team/BLAKE3-specs
+		alignas(64) inline constexpr uint8_t BLAKE3_SCHEDULE[7][16] = {
+			{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+			{ 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 },
+			{ 3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1 },
+			{ 10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6 },
+			{ 12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4 },
+			{ 9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7 },
+			{ 11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13 }
+		};
+		inline constexpr uint32_t BLAKE3_CHUNK_START = 1, BLAKE3_CHUNK_END = 2, BLAKE3_PARENT = 4;
+		inline constexpr uint32_t BLAKE3_ROOT = 8, BLAKE3_KEYED_HASH = 16;
+
+		// BLAKE3 round _R: BLAKE2s' G function with BLAKE3's message schedule
+		template <size_t _R>
+		inline void blake3_round(uint32_t v[16], const uint32_t m[16]) noexcept {
+			typedef uint32_t _Word;
+			constexpr const uint8_t* s = BLAKE3_SCHEDULE[_R];
+
+			HASHPP_BLAKE2_G(0, 4, 8, 12, m[s[0]], m[s[1]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(1, 5, 9, 13, m[s[2]], m[s[3]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(2, 6, 10, 14, m[s[4]], m[s[5]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(3, 7, 11, 15, m[s[6]], m[s[7]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(0, 5, 10, 15, m[s[8]], m[s[9]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(1, 6, 11, 12, m[s[10]], m[s[11]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(2, 7, 8, 13, m[s[12]], m[s[13]], 16, 12, 8, 7);
+			HASHPP_BLAKE2_G(3, 4, 9, 14, m[s[14]], m[s[15]], 16, 12, 8, 7);
 		}
-		constexpr uint32_t hashpp::MD::MD5::F(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) | (~B & D)); }
-		constexpr uint32_t hashpp::MD::MD5::G(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & D) | (C & ~D)); }
-		constexpr uint32_t hashpp::MD::MD5::H(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B ^ C ^ D)); }
-		constexpr uint32_t hashpp::MD::MD5::I(const uint32_t B, const uint32_t C, const uint32_t D) { return (C ^ (B | ~D)); }
 
-		// MD4
-		inline void hashpp::MD::MD4::ctx_init() {
-			this->context = {
-				0,
-				{this->A, this->B, this->C, this->D}
-			};
+		template <size_t... _R>
+		inline void blake3_rounds(uint32_t v[16], const uint32_t m[16], std::index_sequence<_R...>) noexcept {
+			(blake3_round<_R>(v, m), ...);
 		}
-		inline void hashpp::MD::MD4::ctx_transform(const uint32_t* data) {
-			uint32_t results[4] {
-				this->context.buf[0], // a0
-				this->context.buf[1], // b0
-				this->context.buf[2], // c0
-				this->context.buf[3]  // d0
-			};
 
-			// perform rounds as described by the algorithm
-			// as per: http://practicalcryptography.com/hashes/md4-hash/
-			for (uint32_t i = 0, j = 0; i < 4; ++i, j += 4) {
-				this->R1(results[0], results[1], results[2], results[3], data[j], 3);
-				this->R1(results[3], results[0], results[1], results[2], data[j + 1], 7);
-				this->R1(results[2], results[3], results[0], results[1], data[j + 2], 11);
-				this->R1(results[1], results[2], results[3], results[0], data[j + 3], 19);
+		// portable BLAKE3 compression of a 64-byte block, of which 'len' bytes are message (the
+		// rest being zeros), into the chaining value 'cv'; only the first eight words of output
+		// are kept: the next chaining value, or the digest at the root
+		inline void blake3_compress(uint32_t cv[8], const uint8_t* block, uint32_t len, uint64_t counter, uint32_t flags) noexcept {
+			uint32_t m[16], v[16];
+			for (size_t i = 0; i < 16; ++i) {
+				m[i] = blake2_word<uint32_t>(block + i * 4);
 			}
-
-			for (uint32_t i = 0; i < 4; ++i) {
-				this->R2(results[0], results[1], results[2], results[3], data[0 + i], 3);
-				this->R2(results[3], results[0], results[1], results[2], data[4 + i], 5);
-				this->R2(results[2], results[3], results[0], results[1], data[8 + i], 9);
-				this->R2(results[1], results[2], results[3], results[0], data[12 + i], 13);
+			for (size_t i = 0; i < 8; ++i) {
+				v[i] = cv[i];
 			}
+			v[8] = SHA256_H[0]; v[9] = SHA256_H[1]; v[10] = SHA256_H[2]; v[11] = SHA256_H[3];
+			v[12] = static_cast<uint32_t>(counter); v[13] = static_cast<uint32_t>(counter >> 32);
+			v[14] = len; v[15] = flags;
 
-			for (uint32_t i = 0, _h = 0; i < 4; ++i) {
-				i == 1 ? _h = 2 : 0; i == 2 ? _h = 1 : 0; i == 3 ? _h = 3 : 0;
-				this->R3(results[0], results[1], results[2], results[3], data[0 + _h], 3);
-				this->R3(results[3], results[0], results[1], results[2], data[8 + _h], 9);
-				this->R3(results[2], results[3], results[0], results[1], data[4 + _h], 11);
-				this->R3(results[1], results[2], results[3], results[0], data[12 + _h], 15);
+			blake3_rounds(v, m, std::make_index_sequence<7>());
+
+			for (size_t i = 0; i < 8; ++i) {
+				cv[i] = v[i] ^ v[i + 8];
 			}
+		}
 
-			for (uint32_t z = 0; z < 4; z++) {
-				this->context.buf[z] += results[z];
+		// little-endian store of a BLAKE3 chaining value
+		inline void blake3_store(const uint32_t cv[8], uint8_t* out) noexcept {
+			for (size_t i = 0; i < 32; ++i) {
+				out[i] = static_cast<uint8_t>(cv[i / 4] >> (8 * (i % 4)));
 			}
 		}
-		inline void hashpp::MD::MD4::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t input[16], offset = this->context.size % 64;
-			this->context.size += static_cast<uint64_t>(len);
 
-			for (uint32_t i = 0; i < len; ++i) {
-				this->context.in[offset++] = static_cast<uint8_t>(*(data + i));
+		// BLAKE3 chaining values (32 bytes each, to 'out') of inputs of 'blocks' 64-byte blocks,
+		// each hashed from 'key'; the first block of each adds 'start' to 'flags' and the last
+		// 'end', and with 'increment' set input i is hashed with counter 'counter' + i (chunks),
+		// otherwise all with 'counter' (parents). This portable kernel hashes a single input
+		inline void blake3_x1_generic(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+			bool increment, uint32_t flags, uint32_t start, uint32_t end, uint8_t* out) noexcept {
+			(void)increment;
+			uint32_t cv[8];
+			memcpy(cv, key, sizeof(cv));
 
-				if (offset % 64 == 0) {
-					for (uint32_t j = 0; j < 16; ++j) {
-						input[j] = static_cast<uint32_t>(this->context.in[(j * 4) + 3]) << 24 |
-							static_cast<uint32_t>(this->context.in[(j * 4) + 2]) << 16 |
-							static_cast<uint32_t>(this->context.in[(j * 4) + 1]) << 8 |
-							static_cast<uint32_t>(this->context.in[(j * 4)]);
-					}
-					this->ctx_transform(input);
-					offset = 0;
-				}
+			for (size_t b = 0; b < blocks; ++b) {
+				blake3_compress(cv, inputs[0] + b * 64, 64, counter, flags | (b == 0 ? start : 0) | (b + 1 == blocks ? end : 0));
 			}
+			blake3_store(cv, out);
 		}
-		inline void hashpp::MD::MD4::ctx_final() {
-			uint32_t input[16];
-			uint32_t offset = this->context.size % 64, plen = offset < 56 ? 56 - offset : (56 + 64) - offset;
 
-			this->ctx_update(this->pad, plen);
-			this->context.size -= static_cast<uint64_t>(plen);
+		// BLAKE3 chaining value (or with 'root' set, digest) of the chunk of 'len' bytes (up to
+		// 1024) at 'data', chunk number 'counter' of the message
+		inline void blake3_chunk(const uint8_t* data, size_t len, const uint32_t key[8], uint64_t counter, uint32_t flags,
+			bool root, uint8_t out[32]) noexcept {
+			const size_t blocks = len == 0 ? 1 : (len + 63) / 64;
+			uint32_t cv[8];
+			memcpy(cv, key, sizeof(cv));
+
+			for (size_t b = 0; b < blocks; ++b) {
+				uint8_t block[64] = { 0 };
+				const size_t n = b + 1 < blocks ? 64 : len - b * 64;
+				memcpy(block, data + b * 64, n);
 
-			for (uint32_t j = 0; j < 14; ++j) {
-				input[j] = static_cast<uint32_t>(this->context.in[(j * 4) + 3]) << 24 |
-					static_cast<uint32_t>(this->context.in[(j * 4) + 2]) << 16 |
-					static_cast<uint32_t>(this->context.in[(j * 4) + 1]) << 8 |
-					static_cast<uint32_t>(this->context.in[(j * 4)]);
+				uint32_t f = flags | (b == 0 ? BLAKE3_CHUNK_START : 0);
+				if (b + 1 == blocks) {
+					f |= BLAKE3_CHUNK_END | (root ? BLAKE3_ROOT : 0);
+				}
+				blake3_compress(cv, block, static_cast<uint32_t>(n), counter, f);
 			}
-			input[14] = static_cast<uint32_t>(this->context.size * 8);
-			input[15] = static_cast<uint32_t>((this->context.size * 8) >> 32);
+			blake3_store(cv, out);
+		}
 
-			this->ctx_transform(input);
+		// BLAKE3 chaining value (or with 'root' set, digest) of the parent of the two chaining
+		// values in 'children'; 'out' may alias 'children'
+		inline void blake3_parent(const uint8_t children[64], const uint32_t key[8], uint32_t flags, bool root,
+			uint8_t out[32]) noexcept {
+			uint32_t cv[8];
+			memcpy(cv, key, sizeof(cv));
+			blake3_compress(cv, children, 64, 0, flags | BLAKE3_PARENT | (root ? BLAKE3_ROOT : 0));
+			blake3_store(cv, out);
+		}
 
-			// move to digest as big-endian
-			// as per: https://stackoverflow.com/questions/19275955/convert-little-endian-to-big-endian/19276193
-			for (uint32_t i = 0; i < 4; ++i) {
-				this->context.digest[(i * 4) + 0] = static_cast<uint8_t>((this->context.buf[i] & 0x000000FF));
-				this->context.digest[(i * 4) + 1] = static_cast<uint8_t>((this->context.buf[i] & 0x0000FF00) >> 8);
-				this->context.digest[(i * 4) + 2] = static_cast<uint8_t>((this->context.buf[i] & 0x00FF0000) >> 16);
-				this->context.digest[(i * 4) + 3] = static_cast<uint8_t>((this->context.buf[i] & 0xFF000000) >> 24);
-			}
+#undef HASHPP_ROR
+#undef HASHPP_BLAKE2_G
+
+		// BLAKE2b and BLAKE2s compression
+		inline void blake2b_generic(uint64_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) noexcept {
+			blake2_generic<uint64_t, 12>(h, data, blocks, counter, last);
 		}
-		inline std::string MD4::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+		inline void blake2s_generic(uint32_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) noexcept {
+			blake2_generic<uint32_t, 10>(h, data, blocks, counter, last);
 		}
-		inline std::string MD4::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[64] = {0};
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
+		// incremental UTF-8 to UTF-16LE conversion for ENCODINGS::UTF16LE, producing
+		// the widened bytes a block at a time rather than as a widened copy
+		class utf16le {
+		public:
+			void reset(const std::string& data) noexcept {
+				this->p = reinterpret_cast<const uint8_t*>(data.data());
+				this->end = this->p + data.length();
+				this->pending = 0;
+			}
+
+			// number of bytes 'data' occupies once widened
+			static size_t length(const std::string& data) noexcept {
+				const uint8_t* p = reinterpret_cast<const uint8_t*>(data.data());
+				const uint8_t* end = p + data.length();
+				size_t units = 0;
+
+				while (p != end) {
+					if (*p < 0x80) {
+						++p; ++units;
+					}
+					else {
+						units += decode(p, end) >= 0x10000 ? 2 : 1;
+					}
 				}
+				return units * 2;
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
+
+			// writes the next 'bytes' (an even count) widened bytes to 'dst'
+			void read(uint8_t* dst, size_t bytes) noexcept {
+				for (size_t i = 0; i < bytes; i += 2) {
+					uint32_t u = this->pending;
+					if (u != 0) {
+						this->pending = 0;
+					}
+					else if (*this->p < 0x80) {
+						u = *this->p++;
+					}
+					else {
+						u = decode(this->p, this->end);
+						if (u >= 0x10000) {
+							u -= 0x10000;
+							this->pending = static_cast<uint16_t>(0xDC00 | (u & 0x3FF));
+							u = 0xD800 | (u >> 10);
+						}
+					}
+					dst[i] = static_cast<uint8_t>(u);
+					dst[i + 1] = static_cast<uint8_t>(u >> 8);
 				}
 			}
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
-			}
+		private:
+			const uint8_t* p = nullptr;
+			const uint8_t* end = nullptr;
+			uint16_t pending = 0;	// low surrogate owed from the previous code point
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
-			}
+			// decodes one code point, replacing each maximal invalid subsequence with
+			// U+FFFD as recommended by the Unicode standard (section 3.9)
+			static uint32_t decode(const uint8_t*& p, const uint8_t* end) noexcept {
+				uint32_t c = *p++, n;
+				uint8_t lo = 0x80, hi = 0xBF;	// valid range of the first continuation byte
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+				if (c < 0x80) {
+					return c;
+				}
+				else if (c >= 0xC2 && c <= 0xDF) {
+					n = 1; c &= 0x1F;
+				}
+				else if (c >= 0xE0 && c <= 0xEF) {
+					n = 2; c &= 0x0F;
+					lo = (c == 0x00) ? 0xA0 : 0x80;	// overlong forms
+					hi = (c == 0x0D) ? 0x9F : 0xBF;	// surrogates
+				}
+				else if (c >= 0xF0 && c <= 0xF4) {
+					n = 3; c &= 0x07;
+					lo = (c == 0x00) ? 0x90 : 0x80;	// overlong forms
+					hi = (c == 0x04) ? 0x8F : 0xBF;	// beyond U+10FFFF
+				}
+				else {
+					return 0xFFFD;
+				}
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
+				for (; n != 0; --n, lo = 0x80, hi = 0xBF) {
+					if (p == end || *p < lo || *p > hi) {
+						return 0xFFFD;
+					}
+					c = (c << 6) | (*p++ & 0x3F);
+				}
+				return c;
 			}
+		};
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+		// appends the 0x80 terminator and the bit length of a 'total'-byte message to its
+		// final 'rem' bytes, already copied to the zeroed 'block'; returns the block count (1 or 2)
+		template <class _Traits>
+		constexpr size_t pad(uint8_t* block, size_t rem, uint64_t total) noexcept {
+			const size_t tails = (rem + 1 + _Traits::LENGTH <= _Traits::BLOCK) ? 1 : 2;
+			const uint64_t bits = total << 3;
+			block[rem] = 0x80;
+
+			// the bit length occupies the last 8 bytes, preceded by the upper
+			// 64 bits of a 128-bit length for the 128-byte block algorithms
+			uint8_t* length = block + (tails * _Traits::BLOCK) - 8;
+			for (uint32_t i = 0; i < 8; ++i) {
+				if (_Traits::MSB_FIRST) {
+					length[7 - i] = static_cast<uint8_t>(bits >> (i * 8));
+					if (_Traits::LENGTH == 16) {
+						length[-1 - static_cast<int>(i)] = static_cast<uint8_t>((total >> 61) >> (i * 8));
+					}
+				}
+				else {
+					length[i] = static_cast<uint8_t>(bits >> (i * 8));
+				}
 			}
-
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
-		}
-		constexpr uint32_t hashpp::MD::MD4::F(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) | (~B & D)); }
-		constexpr uint32_t hashpp::MD::MD4::G(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) | (B & D) | (C & D)); }
-		constexpr uint32_t hashpp::MD::MD4::H(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B ^ C ^ D)); }
-		constexpr void hashpp::MD::MD4::R1(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s) {
-			a = this->rl32(a + this->F(b, c, d) + k, s);
+			return tails;
 		}
-		constexpr void hashpp::MD::MD4::R2(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s) {
-			a = this->rl32(a + this->G(b, c, d) + k + static_cast<uint32_t>(0x5A827999), s);
-		}
-		constexpr void hashpp::MD::MD4::R3(uint32_t& a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t k, const uint32_t s) {
-			a = this->rl32(a + this->H(b, c, d) + k + static_cast<uint32_t>(0x6ED9EBA1), s);
+
+		// writes the first 'digestSize' bytes of 'state' to 'hex' as hexadecimal
+		template <class _Traits>
+		inline void toHex(const typename _Traits::word* state, size_t digestSize, char* hex) noexcept {
+			typedef typename _Traits::word word;
+			const char* digits = "0123456789abcdef";
+
+			for (size_t i = 0; i < digestSize; ++i) {
+				const word w = state[i / sizeof(word)];
+				const size_t shift = _Traits::MSB_FIRST ? (sizeof(word) - 1 - (i % sizeof(word))) * 8 : (i % sizeof(word)) * 8;
+				const uint8_t b = static_cast<uint8_t>(w >> shift);
+				hex[i * 2] = digits[b >> 4];
+				hex[i * 2 + 1] = digits[b & 0x0F];
+			}
 		}
 
-		// MD2
-		inline void hashpp::MD::MD2::ctx_init() {
-			memset(this->context.state, 0, 48);
-			memset(this->context.checksum, 0, 16);
-			memset(this->context.buf, 0, 16);
-			memset(this->context.digest, 0, 16);
-			this->context.size = 0;
+		// hashes a message that fits in two blocks with its padding (at most
+		// 2 * BLOCK - LENGTH - 1 bytes) entirely on the stack, writing the
+		// hexadecimal digest to 'hex'
+		template <class _Traits>
+		inline void oneshot(const typename _Traits::word* iv, size_t digestSize,
+			void (*single)(typename _Traits::word*, const uint8_t*, size_t), const uint8_t* data, size_t len, char* hex) noexcept {
+			typename _Traits::word state[_Traits::WORDS];
+			uint8_t block[2 * _Traits::BLOCK] = { 0 };
+
+			memcpy(state, iv, sizeof(state));
+			memcpy(block, data, len);
+			single(state, block, pad<_Traits>(block, len, len));
+			toHex<_Traits>(state, digestSize, hex);
 		}
-		inline void hashpp::MD::MD2::ctx_transform(const uint8_t* data) {
-			uint32_t j, k, t;
 
-			for (j = 0; j < 16; ++j) {
-				this->context.state[j + 16] = data[j];
-				this->context.state[j + 32] = (this->context.state[j + 16] ^ this->context.state[j]);
-			}
+		// the padding of an _N-byte message, built at compile time: the final TAILS blocks
+		// with zeros in place of the last REM message bytes and, when the last of them holds
+		// no message bytes, that block's message schedule as expanded by _Schedule
+		template <class _Traits, size_t _N, size_t _W = 1, void (*_Schedule)(typename _Traits::word*, const uint8_t*) = nullptr>
+		struct padding {
+			static constexpr size_t FULL = _N / _Traits::BLOCK, REM = _N % _Traits::BLOCK;
+			static constexpr size_t TAILS = (REM + 1 + _Traits::LENGTH <= _Traits::BLOCK) ? 1 : 2;
+			// _Schedule is tested by matching against the padding without one, as -fsanitize=undefined
+			// builds do not fold a comparison of a function pointer with nullptr into a constant
+			static constexpr bool SCHEDULED = !std::is_same_v<padding, padding<_Traits, _N, _W>> && (REM == 0 || TAILS == 2);
+
+			uint8_t bytes[2 * _Traits::BLOCK];
+			typename _Traits::word w[_W];
 
-			t = 0;
-			for (j = 0; j < 18; ++j) {
-				for (k = 0; k < 48; ++k) {
-					this->context.state[k] ^= this->S[t];
-					t = this->context.state[k];
+			constexpr padding() noexcept : bytes(), w() {
+				pad<_Traits>(this->bytes, REM, _N);
+				if constexpr (SCHEDULED) {
+					_Schedule(this->w, this->bytes + (TAILS - 1) * _Traits::BLOCK);
 				}
-				t = (t + j) & 0xFF;
 			}
+		};
+
+		// hashes the _N bytes at 'data' with the padding built at compile time, writing the
+		// hexadecimal digest to 'hex'; given 'rounds', a last block holding only padding is
+		// compressed from its precomputed message schedule
+		template <class _Traits, size_t _N, size_t _W = 1, void (*_Schedule)(typename _Traits::word*, const uint8_t*) = nullptr>
+		inline void fixed(const typename _Traits::word* iv, size_t digestSize,
+			void (*single)(typename _Traits::word*, const uint8_t*, size_t),
+			void (*rounds)(typename _Traits::word*, const typename _Traits::word*), const uint8_t* data, char* hex) noexcept {
+			typedef padding<_Traits, _N, _W, _Schedule> P;
+			static constexpr P tail = P();
+			typename _Traits::word state[_Traits::WORDS];
+			uint8_t block[2 * _Traits::BLOCK];
 
-			t = this->context.checksum[15];
-			for (j = 0; j < 16; ++j) {
-				this->context.checksum[j] ^= this->S[data[j] ^ t];
-				t = this->context.checksum[j];
+			memcpy(state, iv, sizeof(state));
+			if constexpr (P::FULL != 0) {
+				single(state, data, P::FULL);
 			}
-		}
-		inline void hashpp::MD::MD2::ctx_update(const uint8_t* data, size_t len) {
-			for (uint16_t i = 0; i < len; ++i) {
-				this->context.buf[this->context.size] = data[i];
-				this->context.size++;
-				if (this->context.size == 16) {
-					ctx_transform(this->context.buf);
-					this->context.size = 0;
+
+			if (P::SCHEDULED && rounds != nullptr) {
+				// only the first of two tail blocks holds message bytes, if either does
+				if constexpr (P::TAILS == 2) {
+					memcpy(block, tail.bytes, _Traits::BLOCK);
+					memcpy(block, data + P::FULL * _Traits::BLOCK, P::REM);
+					single(state, block, 1);
 				}
+				rounds(state, tail.w);
 			}
-		}
-		inline void hashpp::MD::MD2::ctx_final() {
-			uint32_t pad = 16 - this->context.size;
-			while (this->context.size < 16) {
-				this->context.buf[this->context.size++] = pad;
+			else {
+				memcpy(block, tail.bytes, P::TAILS * _Traits::BLOCK);
+				memcpy(block, data + P::FULL * _Traits::BLOCK, P::REM);
+				single(state, block, P::TAILS);
 			}
-			ctx_transform(this->context.buf);
-			ctx_transform(this->context.checksum);
-			memcpy(this->context.digest, this->context.state, 16);
+			toHex<_Traits>(state, digestSize, hex);
 		}
-		inline std::string MD2::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
-		}
-		inline std::string MD2::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[16] = {0};
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
+		// multi-buffer driver hashing many independent messages through a kernel
+		// that compresses one block from each of _Lanes messages per call
+		//
+		// the kernel's state is held word-major (word w of lane l at [w * _Lanes + l])
+		// so vector kernels can load a word for all lanes at once. a lane is refilled
+		// with the next message as soon as its own message is exhausted, so messages
+		// of differing lengths keep every lane busy; once no messages are left to
+		// assign and fewer than half of the lanes are busy, the stragglers are
+		// finished one at a time by the single-stream compression function.
+		//
+		// 'prefix' bytes are assumed to have already been compressed into 'iv' (as
+		// with the key block of an HMAC pass) and are counted in the encoded length.
+		// with 'utf16' set, messages are widened block by block into per-lane buffers.
+		template <class _Traits, size_t _Lanes>
+		class multibuffer {
+		public:
+			typedef typename _Traits::word word;
+			typedef void (*kernel_t)(word*, const uint8_t* const*);
+			typedef void (*single_t)(word*, const uint8_t*, size_t);
+
+			multibuffer(kernel_t kernel, single_t single, const word* iv, size_t digestSize, uint64_t prefix = 0) noexcept
+				: kernel(kernel), single(single), iv(iv), digestSize(digestSize), prefix(prefix) {
+			}
+
+			// hashes each string in 'data', appending the digests to 'out' in order,
+			// either as hexadecimal strings or as raw digest bytes
+			void run(const std::vector<std::string>& data, std::vector<std::string>& out, bool hex = true, bool utf16 = false) {
+				this->hex = hex;
+				this->utf16 = utf16;
+				const size_t base = out.size();
+				size_t next = 0, active = 0;
+				out.resize(base + data.size());
+
+				for (size_t l = 0; l < _Lanes; ++l) {
+					this->lanes[l].busy = false;
+					this->blocks[l] = this->idle;
+				}
+
+				for (;;) {
+					for (size_t l = 0; l < _Lanes; ++l) {
+						if (!this->lanes[l].busy && next < data.size()) {
+							this->assign(l, next, data[next]);
+							++next; ++active;
+						}
+					}
+					if (active == 0) {
+						break;
+					}
+
+					if (next == data.size() && active * 2 < _Lanes) {
+						for (size_t l = 0; l < _Lanes; ++l) {
+							if (this->lanes[l].busy) {
+								this->finish(l, out[base + this->lanes[l].job]);
+							}
+						}
+						break;
+					}
+
+					for (size_t l = 0; l < _Lanes; ++l) {
+						this->blocks[l] = this->lanes[l].busy ? this->next(this->lanes[l]) : this->idle;
+					}
+					this->kernel(this->state, this->blocks);
+
+					for (size_t l = 0; l < _Lanes; ++l) {
+						lane& L = this->lanes[l];
+						if (!L.busy) {
+							continue;
+						}
+
+						if (L.full) {
+							if (!this->utf16) {
+								L.ptr += _Traits::BLOCK;
+							}
+							--L.full;
+						}
+						else {
+							L.tail += _Traits::BLOCK;
+							--L.tails;
+						}
+
+						if (!L.full && !L.tails) {
+							this->digest(l, out[base + L.job]);
+							L.busy = false;
+							--active;
+						}
+					}
 				}
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
+
+		private:
+			struct lane {
+				const uint8_t* ptr;	// next full block of the message
+				const uint8_t* tail;	// next padded block
+				size_t full, tails, job, rem;
+				bool busy, staged;	// 'staged' once the tail bytes are in 'pad'
+				uint8_t pad[2 * _Traits::BLOCK];
+				uint8_t wide[_Traits::BLOCK];
+				utf16le reader;
+			};
+
+			kernel_t kernel;
+			single_t single;
+			const word* iv;
+			size_t digestSize;
+			uint64_t prefix;
+			bool hex = true, utf16 = false;
+
+			alignas(64) word state[_Traits::WORDS * _Lanes];
+			const uint8_t* blocks[_Lanes];
+			lane lanes[_Lanes];
+			uint8_t idle[_Traits::BLOCK] = { 0 };
+
+			// loads message 'job' into lane 'l', staging its padded final block(s)
+			void assign(size_t l, size_t job, const std::string& message) {
+				lane& L = this->lanes[l];
+				const size_t len = this->utf16 ? utf16le::length(message) : message.length(), rem = len % _Traits::BLOCK;
+
+				L.ptr = reinterpret_cast<const uint8_t*>(message.data());
+				L.full = len / _Traits::BLOCK;
+				L.tail = L.pad;
+				L.job = job;
+				L.rem = rem;
+				L.busy = true;
+
+				memset(L.pad, 0, sizeof(L.pad));
+				if (this->utf16) {
+					L.reader.reset(message);
+					L.staged = false;
 				}
-			}
+				else {
+					memcpy(L.pad, L.ptr + (L.full * _Traits::BLOCK), rem);
+					L.staged = true;
+				}
+				L.tails = hashpp::simd::pad<_Traits>(L.pad, rem, static_cast<uint64_t>(len) + this->prefix);
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
+				for (size_t w = 0; w < _Traits::WORDS; ++w) {
+					this->state[w * _Lanes + l] = this->iv[w];
+				}
 			}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
+			// returns lane L's next block, widening it first in UTF-16LE mode
+			const uint8_t* next(lane& L) {
+				if (L.full) {
+					if (!this->utf16) {
+						return L.ptr;
+					}
+					L.reader.read(L.wide, _Traits::BLOCK);
+					return L.wide;
+				}
+				if (!L.staged) {
+					L.reader.read(L.pad, L.rem);
+					L.staged = true;
+				}
+				return L.tail;
 			}
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+			// completes lane 'l' with the single-stream compression function
+			void finish(size_t l, std::string& result) {
+				lane& L = this->lanes[l];
+				word s[_Traits::WORDS];
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
-			}
+				for (size_t w = 0; w < _Traits::WORDS; ++w) {
+					s[w] = this->state[w * _Lanes + l];
+				}
+				if (this->utf16) {
+					for (; L.full != 0; --L.full) {
+						this->single(s, this->next(L), 1);
+					}
+				}
+				else {
+					this->single(s, L.ptr, L.full);
+					L.full = 0;
+				}
+				this->single(s, this->next(L), L.tails);
+				for (size_t w = 0; w < _Traits::WORDS; ++w) {
+					this->state[w * _Lanes + l] = s[w];
+				}
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+				this->digest(l, result);
+				L.busy = false;
 			}
 
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
-		}
-	}
-
-	// Secure Hash Algorithm (SHA) hash family 
-	namespace SHA {
-		// SHA algorithms, such as SHA2-224, SHA2-384,
-		// SHA2-512-224, and SHA2-512-256 are simply
-		// truncated versions of their accompanying
-		// algorithm.
-		//
-		// for instance, SHA2-512-256 is SHA-512
-		// truncated to a 256-bit digest length.
-		// likewise, SHA2-224 is SHA2-256 truncated
-		// to a 224-bit digest length.
-		//
-		// these truncations are achieved via the 
-		// omission of trailing H-constants from
-		// the digest output, as well as different
-		// H-constant values from the orignal
-		// algorithm.
+			void digest(size_t l, std::string& result) const {
+				const char* digits = "0123456789abcdef";
+				result.resize(this->hex ? this->digestSize * 2 : this->digestSize);
 
-		class SHA1 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 20);
+				for (size_t i = 0; i < this->digestSize; ++i) {
+					const word w = this->state[(i / sizeof(word)) * _Lanes + l];
+					const size_t shift = _Traits::MSB_FIRST ? (sizeof(word) - 1 - (i % sizeof(word))) * 8 : (i % sizeof(word)) * 8;
+					const uint8_t b = static_cast<uint8_t>(w >> shift);
+					if (this->hex) {
+						result[i * 2] = digits[b >> 4];
+						result[i * 2 + 1] = digits[b & 0x0F];
+					}
+					else {
+						result[i] = static_cast<char>(b);
+					}
+				}
 			}
+		};
 
-		private:
-			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 20;
+		// multi-lane MD2 driver, the MD2 counterpart of multibuffer above; MD2's
+		// byte-valued padding and trailing checksum block take the place of the
+		// length encoding, and the kernel works on byte-sliced lanes
+		//
+		// lanes are refilled as in multibuffer, and a final straggler is finished
+		// by md2_generic, since a kernel call costs about as much as a single
+		// lane however many of its lanes are busy
+		template <size_t _Lanes>
+		class md2_multibuffer {
+		public:
+			typedef void (*kernel_t)(uint8_t*, uint8_t*, const uint8_t*);
+
+			explicit md2_multibuffer(kernel_t kernel) noexcept : kernel(kernel) {}
+
+			// hashes each string in 'data', appending the hexadecimal digests to 'out' in order
+			void run(const std::vector<std::string>& data, std::vector<std::string>& out, bool utf16 = false) {
+				const size_t base = out.size();
+				size_t next = 0, active = 0;
+				out.resize(base + data.size());
+				this->utf16 = utf16;
+
+				for (size_t l = 0; l < _Lanes; ++l) {
+					this->lanes[l].busy = false;
+				}
+
+				for (;;) {
+					for (size_t l = 0; l < _Lanes; ++l) {
+						if (!this->lanes[l].busy && next < data.size()) {
+							this->assign(l, next, data[next]);
+							++next; ++active;
+						}
+					}
+					if (active == 0) {
+						break;
+					}
 
-			typedef struct {
-				uint32_t state[5], k[4], size;
-				uint64_t bitsize;
-				uint8_t  data[64], digest[20];
-			} CTX;
+					if (next == data.size() && active == 1) {
+						for (size_t l = 0; l < _Lanes; ++l) {
+							if (this->lanes[l].busy) {
+								this->finish(l, out[base + this->lanes[l].job]);
+							}
+						}
+						break;
+					}
 
-			CTX context = { 0 };
+					for (size_t l = 0; l < _Lanes; ++l) {
+						uint8_t block[16] = { 0 };
+						if (this->lanes[l].busy) {
+							this->fill(l, block);
+						}
+						for (size_t j = 0; j < 16; ++j) {
+							this->in[j * _Lanes + l] = block[j];
+						}
+					}
+					this->kernel(this->x, this->c, this->in);
+
+					for (size_t l = 0; l < _Lanes; ++l) {
+						lane& L = this->lanes[l];
+						if (L.busy && --L.left == 0) {
+							this->digest(l, out[base + L.job]);
+							L.busy = false;
+							--active;
+						}
+					}
+				}
+			}
 
-			// constants (H) defined by SHA-1 algorithm
-			// as per: https://datatracker.ietf.org/doc/html/rfc3174
-			const uint32_t H[5] = {
-				0x67452301,
-				0xEFCDAB89,
-				0x98BADCFE,
-				0x10325476,
-				0xc3d2e1f0
+		private:
+			struct lane {
+				const uint8_t* ptr;
+				size_t left, rem, job;	// 'left' counts the data, padding and checksum blocks still due
+				bool busy;
+				utf16le reader;
 			};
 
-			// more constants (K)... as per above
-			const uint32_t K[4] = {
-				0x5a827999,
-				0x6ed9eba1,
-				0x8f1bbcdc,
-				0xca62c1d6
-			};
+			kernel_t kernel;
+			bool utf16 = false;
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+			alignas(64) uint8_t x[48 * _Lanes];
+			alignas(64) uint8_t c[16 * _Lanes];
+			alignas(64) uint8_t in[16 * _Lanes];
+			lane lanes[_Lanes];
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+			void assign(size_t l, size_t job, const std::string& message) {
+				lane& L = this->lanes[l];
+				const size_t len = this->utf16 ? utf16le::length(message) : message.length();
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+				L.ptr = reinterpret_cast<const uint8_t*>(message.data());
+				L.left = len / 16 + 2;
+				L.rem = len % 16;
+				L.job = job;
+				L.busy = true;
+				if (this->utf16) {
+					L.reader.reset(message);
+				}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+				for (size_t i = 0; i < 48; ++i) {
+					this->x[i * _Lanes + l] = 0;
+				}
+				for (size_t i = 0; i < 16; ++i) {
+					this->c[i * _Lanes + l] = 0;
+				}
+			}
 
-			// SHA-1 functions defined by the algorithm
-			constexpr uint32_t A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t B(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t C(const uint32_t A);
+			// writes lane l's next block: a data block, the padded final block, or the checksum
+			void fill(size_t l, uint8_t block[16]) {
+				lane& L = this->lanes[l];
+				const size_t n = L.left > 2 ? 16 : L.rem;
 
-			// ...and more defined functions...
-			constexpr uint32_t F(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t G(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t J(const uint32_t B, const uint32_t C, const uint32_t D);
-		};
-		class SHA2_224 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 28);
+				if (L.left == 1) {
+					for (size_t j = 0; j < 16; ++j) {
+						block[j] = this->c[j * _Lanes + l];
+					}
+					return;
+				}
+
+				if (this->utf16) {
+					L.reader.read(block, n);
+				}
+				else {
+					memcpy(block, L.ptr, n);
+					L.ptr += n;
+				}
+				for (size_t j = n; j < 16; ++j) {
+					block[j] = static_cast<uint8_t>(16 - n);
+				}
 			}
 
-		private:
-			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 28;
+			void finish(size_t l, std::string& hex) {
+				lane& L = this->lanes[l];
+				uint8_t s[48], sum[16], block[16];
 
-			typedef struct {
-				uint32_t state[8];
-				uint64_t size, bitsize;
-				uint8_t  data[64], digest[28];
-			} CTX;
+				for (size_t i = 0; i < 48; ++i) {
+					s[i] = this->x[i * _Lanes + l];
+				}
+				for (size_t i = 0; i < 16; ++i) {
+					sum[i] = this->c[i * _Lanes + l];
+				}
 
-			CTX context = { 0 };
+				// full data blocks are compressed in place
+				if (!this->utf16 && L.left > 2) {
+					md2_generic(s, sum, L.ptr, L.left - 2);
+					L.ptr += (L.left - 2) * 16;
+					L.left = 2;
+				}
+				for (; L.left != 0; --L.left) {
+					if (L.left == 1) {
+						memcpy(block, sum, 16);
+					}
+					else {
+						const size_t n = L.left > 2 ? 16 : L.rem;
+						if (this->utf16) {
+							L.reader.read(block, n);
+						}
+						else {
+							memcpy(block, L.ptr, n);
+							L.ptr += n;
+						}
+						memset(block + n, static_cast<int>(16 - n), 16 - n);
+					}
+					md2_generic(s, sum, block, 1);
+				}
 
-			// constants (H) defined by SHA2-224 algorithm
-			// as per: https://datatracker.ietf.org/doc/html/rfc3874
-			const uint32_t H[8] = {
-				0xC1059ED8,
-				0x367CD507,
-				0x3070DD17,
-				0xF70E5939,
-				0xFFC00B31,
-				0x68581511,
-				0x64F98FA7,
-				0xBEFA4FA4
-			};
+				for (size_t i = 0; i < 48; ++i) {
+					this->x[i * _Lanes + l] = s[i];
+				}
+				this->digest(l, hex);
+				L.busy = false;
+			}
 
-			// more constants (K)... as per above
-			const uint32_t K[64] = {
-				0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
-				0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
-				0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
-				0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
-				0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
-				0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
-				0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
-				0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
-				0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
-				0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
-				0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
-				0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
-				0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
-				0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
-				0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
-				0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
-			};
+			void digest(size_t l, std::string& hex) const {
+				const char* digits = "0123456789abcdef";
+				hex.resize(32);
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+				for (size_t i = 0; i < 16; ++i) {
+					const uint8_t b = this->x[i * _Lanes + l];
+					hex[i * 2] = digits[b >> 4];
+					hex[i * 2 + 1] = digits[b & 0x0F];
+				}
+			}
+		};
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+		// multi-lane Keccak driver, the SHA-3 and SHAKE counterpart of multibuffer above;
+		// the kernel absorbs one block of 'rate' bytes from each of _Lanes messages into
+		// their word-major states (lane w of message l at [w * _Lanes + l]) and permutes
+		// them. the pad10*1 padding always fits in a single final block, and the digest
+		// (at most one block of output) is read straight from the state
+		//
+		// lanes are refilled and stragglers finished by the single-stream absorb
+		// function as in multibuffer
+		template <size_t _Lanes>
+		class keccak_multibuffer {
+		public:
+			typedef void (*kernel_t)(uint64_t*, const uint8_t* const*, size_t);
+			typedef void (*single_t)(uint64_t*, const uint8_t*, size_t, size_t);
+
+			keccak_multibuffer(kernel_t kernel, single_t single, size_t rate, uint8_t suffix, size_t digestSize) noexcept
+				: kernel(kernel), single(single), rate(rate), suffix(suffix), digestSize(digestSize) {
+			}
+
+			// hashes each string in 'data', appending the hexadecimal digests to 'out' in order
+			void run(const std::vector<std::string>& data, std::vector<std::string>& out, bool utf16 = false) {
+				const size_t base = out.size();
+				size_t next = 0, active = 0;
+				out.resize(base + data.size());
+				this->utf16 = utf16;
+
+				for (size_t l = 0; l < _Lanes; ++l) {
+					this->lanes[l].busy = false;
+					this->blocks[l] = this->idle;
+				}
+
+				for (;;) {
+					for (size_t l = 0; l < _Lanes; ++l) {
+						if (!this->lanes[l].busy && next < data.size()) {
+							this->assign(l, next, data[next]);
+							++next; ++active;
+						}
+					}
+					if (active == 0) {
+						break;
+					}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+					if (next == data.size() && active * 2 < _Lanes) {
+						for (size_t l = 0; l < _Lanes; ++l) {
+							if (this->lanes[l].busy) {
+								this->finish(l, out[base + this->lanes[l].job]);
+							}
+						}
+						break;
+					}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+					for (size_t l = 0; l < _Lanes; ++l) {
+						this->blocks[l] = this->lanes[l].busy ? this->next(this->lanes[l]) : this->idle;
+					}
+					this->kernel(this->state, this->blocks, this->rate);
 
-			constexpr uint32_t A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t F(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t G(const uint32_t B, const uint32_t C, const uint32_t D);
+					// a lane whose padded block was just absorbed is complete
+					for (size_t l = 0; l < _Lanes; ++l) {
+						lane& L = this->lanes[l];
+						if (!L.busy) {
+							continue;
+						}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc6234
-			constexpr uint32_t SIGMA0(const uint32_t A);
-			constexpr uint32_t SIGMA1(const uint32_t A);
-			constexpr uint32_t SIGMA2(const uint32_t A);
-			constexpr uint32_t SIGMA3(const uint32_t A);
-		};
-		class SHA2_256 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 32);
+						if (L.full) {
+							if (!this->utf16) {
+								L.ptr += this->rate;
+							}
+							--L.full;
+						}
+						else {
+							this->digest(l, out[base + L.job]);
+							L.busy = false;
+							--active;
+						}
+					}
+				}
 			}
 
 		private:
-			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 32;
+			struct lane {
+				const uint8_t* ptr;	// next full block of the message
+				size_t full, rem, job;
+				bool busy, staged;	// 'staged' once the final bytes are in 'pad'
+				uint8_t pad[168];	// the padded final block (168 bytes being the largest rate)
+				uint8_t wide[168];
+				utf16le reader;
+			};
 
-			typedef struct {
-				uint32_t state[8], size;
-				uint64_t bitsize;
-				uint8_t  data[64], digest[32];
-			} CTX;
+			kernel_t kernel;
+			single_t single;
+			size_t rate;
+			uint8_t suffix;
+			size_t digestSize;
+			bool utf16 = false;
+
+			alignas(64) uint64_t state[25 * _Lanes];
+			const uint8_t* blocks[_Lanes];
+			lane lanes[_Lanes];
+			uint8_t idle[168] = { 0 };
+
+			// loads message 'job' into lane 'l', padding its final block
+			void assign(size_t l, size_t job, const std::string& message) {
+				lane& L = this->lanes[l];
+				const size_t len = this->utf16 ? utf16le::length(message) : message.length();
+
+				L.ptr = reinterpret_cast<const uint8_t*>(message.data());
+				L.full = len / this->rate;
+				L.rem = len % this->rate;
+				L.job = job;
+				L.busy = true;
+
+				// the final bytes, read later when widening, never reach the padding
+				memset(L.pad, 0, this->rate);
+				L.pad[L.rem] = this->suffix;
+				L.pad[this->rate - 1] |= 0x80;
+				if (this->utf16) {
+					L.reader.reset(message);
+					L.staged = false;
+				}
+				else {
+					memcpy(L.pad, L.ptr + L.full * this->rate, L.rem);
+					L.staged = true;
+				}
 
-			CTX context = { 0 };
+				for (size_t w = 0; w < 25; ++w) {
+					this->state[w * _Lanes + l] = 0;
+				}
+			}
 
-			// constants (H) defined by SHA-256 algorithm
-			// as per: https://datatracker.ietf.org/doc/html/rfc6234
-			const uint32_t H[8] = {
-				0x6a09e667,
-				0xbb67ae85,
-				0x3c6ef372,
-				0xa54ff53a,
-				0x510e527f,
-				0x9b05688c,
-				0x1f83d9ab,
-				0x5be0cd19
-			};
+			// returns lane L's next block, widening it first in UTF-16LE mode
+			const uint8_t* next(lane& L) {
+				if (L.full) {
+					if (!this->utf16) {
+						return L.ptr;
+					}
+					L.reader.read(L.wide, this->rate);
+					return L.wide;
+				}
+				if (!L.staged) {
+					L.reader.read(L.pad, L.rem);
+					L.staged = true;
+				}
+				return L.pad;
+			}
 
-			// more constants (K)... as per above
-			const uint32_t K[64] = {
-				0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-				0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-				0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-				0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-				0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-				0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-				0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-				0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-				0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-				0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-				0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-				0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-				0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-				0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-				0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-				0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-			};
+			// completes lane 'l' with the single-stream absorb function
+			void finish(size_t l, std::string& hex) {
+				lane& L = this->lanes[l];
+				uint64_t s[25];
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+				for (size_t w = 0; w < 25; ++w) {
+					s[w] = this->state[w * _Lanes + l];
+				}
+				if (this->utf16) {
+					for (; L.full != 0; --L.full) {
+						this->single(s, this->next(L), 1, this->rate);
+					}
+				}
+				else {
+					this->single(s, L.ptr, L.full, this->rate);
+					L.full = 0;
+				}
+				this->single(s, this->next(L), 1, this->rate);
+				for (size_t w = 0; w < 25; ++w) {
+					this->state[w * _Lanes + l] = s[w];
+				}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+				this->digest(l, hex);
+				L.busy = false;
+			}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+			void digest(size_t l, std::string& hex) const {
+				const char* digits = "0123456789abcdef";
+				hex.resize(this->digestSize * 2);
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+				for (size_t i = 0; i < this->digestSize; ++i) {
+					const uint8_t b = static_cast<uint8_t>(this->state[(i / 8) * _Lanes + l] >> (8 * (i % 8)));
+					hex[i * 2] = digits[b >> 4];
+					hex[i * 2 + 1] = digits[b & 0x0F];
+				}
+			}
+		};
 
-			constexpr uint32_t A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t F(const uint32_t B, const uint32_t C, const uint32_t D);
-			constexpr uint32_t G(const uint32_t B, const uint32_t C, const uint32_t D);
+#if defined(HASHPP_X86)
+		// SHA-1 compression of 'blocks' consecutive 64-byte blocks using
+		// the Intel SHA extensions (sha1rnds4/sha1nexte/sha1msg1/sha1msg2)
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha1_ni(uint32_t state[5], const uint8_t* data, size_t blocks) {
+			const __m128i MASK = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+			__m128i ABCD, E0, E1, M0, M1, M2, M3, ABCD_SAVE, E0_SAVE;
+
+			// sha1rnds4 expects A in the most significant lane and E held separately
+			ABCD = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+			E0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+// four rounds of function f with the E value derived from e_in, saving A for the next group in e_out
+#define HASHPP_SHA1_RNDS(e_in, e_out, m, f) do {	\
+	(e_in) = _mm_sha1nexte_epu32((e_in), (m));	\
+	(e_out) = ABCD;					\
+	ABCD = _mm_sha1rnds4_epu32(ABCD, (e_in), (f));	\
+} while(0)
+
+// next four message schedule words from the previous sixteen (a being the oldest)
+#define HASHPP_SHA1_MSG(a, b, c, d) do {										\
+	(a) = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32((a), (b)), (c)), (d));	\
+} while(0)
+
+			for (; blocks != 0; --blocks, data += 64) {
+				ABCD_SAVE = ABCD;
+				E0_SAVE = E0;
+
+				M0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), MASK);
+				M1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), MASK);
+				M2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), MASK);
+				M3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), MASK);
+
+				// rounds 0-19
+				E0 = _mm_add_epi32(E0, M0);
+				E1 = ABCD;
+				ABCD = _mm_sha1rnds4_epu32(ABCD, E0, 0);
+				HASHPP_SHA1_RNDS(E1, E0, M1, 0);
+				HASHPP_SHA1_RNDS(E0, E1, M2, 0);
+				HASHPP_SHA1_RNDS(E1, E0, M3, 0);
+				HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 0);
+
+				// rounds 20-39
+				HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 1);
+				HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 1);
+				HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 1);
+				HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 1);
+				HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 1);
+
+				// rounds 40-59
+				HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 2);
+				HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 2);
+				HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 2);
+				HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 2);
+				HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 2);
+
+				// rounds 60-79
+				HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 3);
+				HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 3);
+				HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 3);
+				HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 3);
+				HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 3);
+
+				E0 = _mm_sha1nexte_epu32(E0, E0_SAVE);
+				ABCD = _mm_add_epi32(ABCD, ABCD_SAVE);
+			}
+
+#undef HASHPP_SHA1_MSG
+#undef HASHPP_SHA1_RNDS
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(ABCD, 0x1B));
+			state[4] = static_cast<uint32_t>(_mm_extract_epi32(E0, 3));
+		}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc6234
-			constexpr uint32_t SIGMA0(const uint32_t A);
-			constexpr uint32_t SIGMA1(const uint32_t A);
-			constexpr uint32_t SIGMA2(const uint32_t A);
-			constexpr uint32_t SIGMA3(const uint32_t A);
-		};
-		class SHA2_384 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 48);
+		// sha1_ni as a single-lane multibuffer kernel
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha1_x1_ni(uint32_t* state, const uint8_t* const* blocks) {
+			sha1_ni(state, blocks[0], 1);
+		}
+
+		// SHA1 compression of one block for each of _Lanes independent messages, with the
+		// sha1rnds4 chains of the lanes interleaved so that their latencies overlap
+		template <size_t _Lanes>
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha1_xn_ni(uint32_t* state, const uint8_t* const* blocks) {
+			const __m128i MASK = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+			__m128i ABCD[_Lanes], E0[_Lanes], E1[_Lanes], M0[_Lanes], M1[_Lanes], M2[_Lanes], M3[_Lanes];
+			__m128i ABCD_SAVE[_Lanes], E0_SAVE[_Lanes];
+
+			for (size_t l = 0; l < _Lanes; ++l) {
+				ABCD[l] = _mm_set_epi32(static_cast<int>(state[l]), static_cast<int>(state[_Lanes + l]),
+					static_cast<int>(state[2 * _Lanes + l]), static_cast<int>(state[3 * _Lanes + l]));
+				E0[l] = _mm_set_epi32(static_cast<int>(state[4 * _Lanes + l]), 0, 0, 0);
+				ABCD_SAVE[l] = ABCD[l];
+				E0_SAVE[l] = E0[l];
+
+				M0[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l])), MASK);
+				M1[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 16)), MASK);
+				M2[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 32)), MASK);
+				M3[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 48)), MASK);
+			}
+
+// four rounds of function f for every lane, as in sha1_ni
+#define HASHPP_SHA1_RNDS(e_in, e_out, m, f) do {				\
+	for (size_t l = 0; l < _Lanes; ++l) {					\
+		(e_in)[l] = _mm_sha1nexte_epu32((e_in)[l], (m)[l]);		\
+		(e_out)[l] = ABCD[l];						\
+		ABCD[l] = _mm_sha1rnds4_epu32(ABCD[l], (e_in)[l], (f));	\
+	}									\
+} while(0)
+
+// next four message schedule words of every lane from the previous sixteen (a being the oldest)
+#define HASHPP_SHA1_MSG(a, b, c, d) do {										\
+	for (size_t l = 0; l < _Lanes; ++l) {										\
+		(a)[l] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32((a)[l], (b)[l]), (c)[l]), (d)[l]);	\
+	}														\
+} while(0)
+
+			// rounds 0-19
+			for (size_t l = 0; l < _Lanes; ++l) {
+				E0[l] = _mm_add_epi32(E0[l], M0[l]);
+				E1[l] = ABCD[l];
+				ABCD[l] = _mm_sha1rnds4_epu32(ABCD[l], E0[l], 0);
+			}
+			HASHPP_SHA1_RNDS(E1, E0, M1, 0);
+			HASHPP_SHA1_RNDS(E0, E1, M2, 0);
+			HASHPP_SHA1_RNDS(E1, E0, M3, 0);
+			HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 0);
+
+			// rounds 20-39
+			HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 1);
+			HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 1);
+			HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 1);
+			HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 1);
+			HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 1);
+
+			// rounds 40-59
+			HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 2);
+			HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 2);
+			HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 2);
+			HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 2);
+			HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 2);
+
+			// rounds 60-79
+			HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 3);
+			HASHPP_SHA1_MSG(M0, M1, M2, M3); HASHPP_SHA1_RNDS(E0, E1, M0, 3);
+			HASHPP_SHA1_MSG(M1, M2, M3, M0); HASHPP_SHA1_RNDS(E1, E0, M1, 3);
+			HASHPP_SHA1_MSG(M2, M3, M0, M1); HASHPP_SHA1_RNDS(E0, E1, M2, 3);
+			HASHPP_SHA1_MSG(M3, M0, M1, M2); HASHPP_SHA1_RNDS(E1, E0, M3, 3);
+
+#undef HASHPP_SHA1_MSG
+#undef HASHPP_SHA1_RNDS
+
+			for (size_t l = 0; l < _Lanes; ++l) {
+				alignas(16) uint32_t s[4];
+				E0[l] = _mm_sha1nexte_epu32(E0[l], E0_SAVE[l]);
+				ABCD[l] = _mm_add_epi32(ABCD[l], ABCD_SAVE[l]);
+				_mm_store_si128(reinterpret_cast<__m128i*>(s), _mm_shuffle_epi32(ABCD[l], 0x1B));
+				for (size_t w = 0; w < 4; ++w) {
+					state[w * _Lanes + l] = s[w];
+				}
+				state[4 * _Lanes + l] = static_cast<uint32_t>(_mm_extract_epi32(E0[l], 3));
 			}
+		}
 
-		private:
-			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 48;
+		// SHA-1 compression of one 64-byte block from each of four independent
+		// messages, one message per 32-bit SSE lane (word-major state, see multibuffer)
+		HASHPP_TARGET("ssse3")
+		inline void sha1_x4_ssse3(uint32_t* state, const uint8_t* const* blocks) {
+			const __m128i SWAP = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+			__m128i W[16], S[5];
 
-			typedef struct {
-				uint64_t state[8], count[2];
-				uint8_t  data[128], digest[48];
-			} CTX;
+			// 4x4 transposes of 32-bit words, four message words at a time
+			for (uint32_t q = 0; q < 4; ++q) {
+				const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[0] + q * 16));
+				const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[1] + q * 16));
+				const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[2] + q * 16));
+				const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[3] + q * 16));
+				const __m128i t0 = _mm_unpacklo_epi32(r0, r1), t1 = _mm_unpackhi_epi32(r0, r1);
+				const __m128i t2 = _mm_unpacklo_epi32(r2, r3), t3 = _mm_unpackhi_epi32(r2, r3);
+				W[q * 4] = _mm_shuffle_epi8(_mm_unpacklo_epi64(t0, t2), SWAP);
+				W[q * 4 + 1] = _mm_shuffle_epi8(_mm_unpackhi_epi64(t0, t2), SWAP);
+				W[q * 4 + 2] = _mm_shuffle_epi8(_mm_unpacklo_epi64(t1, t3), SWAP);
+				W[q * 4 + 3] = _mm_shuffle_epi8(_mm_unpackhi_epi64(t1, t3), SWAP);
+			}
 
-			CTX context = { 0 };
+			for (uint32_t i = 0; i < 5; ++i) {
+				S[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(state + i * 4));
+			}
 
-			// constants (H) defined by SHA-512 algorithm
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			const uint64_t H[8] = {
-				0xCBBB9D5DC1059ED8,
-				0x629A292A367CD507,
-				0x9159015A3070DD17,
-				0x152FECD8F70E5939,
-				0x67332667FFC00B31,
-				0x8EB44A8768581511,
-				0xDB0C2E0D64F98FA7,
-				0x47B5481DBEFA4FA4
-			};
+#define HASHPP_ROL32x4(x, n) _mm_or_si128(_mm_slli_epi32((x), (n)), _mm_srli_epi32((x), 32 - (n)))
+#define HASHPP_SHA1_W(i) ((i) < 16 ? W[i] : (W[(i) & 15] = HASHPP_ROL32x4(_mm_xor_si128(_mm_xor_si128(W[((i) - 3) & 15], W[((i) - 8) & 15]),	\
+				_mm_xor_si128(W[((i) - 14) & 15], W[(i) & 15])), 1)))
+#define HASHPP_SHA1_STEP(f, k, i) do {																	\
+				const __m128i t = _mm_add_epi32(_mm_add_epi32(HASHPP_ROL32x4(a, 5), (f)), _mm_add_epi32(_mm_add_epi32(e, (k)), HASHPP_SHA1_W(i)));	\
+				e = d; d = c; c = HASHPP_ROL32x4(b, 30); b = a; a = t;												\
+			} while (0)
 
-			// more constants (K)... as per above
-			const uint64_t K[80] = {
-				0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
-				0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
-				0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
-				0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
-				0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
-				0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
-				0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
-				0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
-				0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
-				0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
-				0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30,
-				0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
-				0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
-				0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
-				0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
-				0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
-				0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
-				0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
-				0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
-				0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
-			};
+			__m128i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4];
+			const __m128i K0 = _mm_set1_epi32(0x5a827999), K1 = _mm_set1_epi32(0x6ed9eba1);
+			const __m128i K2 = _mm_set1_epi32(static_cast<int>(0x8f1bbcdc)), K3 = _mm_set1_epi32(static_cast<int>(0xca62c1d6));
+			for (uint32_t i = 0; i < 20; ++i) {
+				HASHPP_SHA1_STEP(_mm_xor_si128(d, _mm_and_si128(b, _mm_xor_si128(c, d))), K0, i);
+			}
+			for (uint32_t i = 20; i < 40; ++i) {
+				HASHPP_SHA1_STEP(_mm_xor_si128(_mm_xor_si128(b, c), d), K1, i);
+			}
+			for (uint32_t i = 40; i < 60; ++i) {
+				HASHPP_SHA1_STEP(_mm_or_si128(_mm_and_si128(b, c), _mm_and_si128(d, _mm_or_si128(b, c))), K2, i);
+			}
+			for (uint32_t i = 60; i < 80; ++i) {
+				HASHPP_SHA1_STEP(_mm_xor_si128(_mm_xor_si128(b, c), d), K3, i);
+			}
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+#undef HASHPP_SHA1_STEP
+#undef HASHPP_SHA1_W
+#undef HASHPP_ROL32x4
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+			S[0] = _mm_add_epi32(S[0], a); S[1] = _mm_add_epi32(S[1], b); S[2] = _mm_add_epi32(S[2], c);
+			S[3] = _mm_add_epi32(S[3], d); S[4] = _mm_add_epi32(S[4], e);
+			for (uint32_t i = 0; i < 5; ++i) {
+				_mm_store_si128(reinterpret_cast<__m128i*>(state + i * 4), S[i]);
+			}
+		}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+		// SHA-256 (and SHA2-224) compression of 'blocks' consecutive 64-byte
+		// blocks using the Intel SHA extensions (sha256rnds2/sha256msg1/sha256msg2)
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha256_ni(uint32_t state[8], const uint8_t* data, size_t blocks) {
+			const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+			__m128i S0, S1, T, M0, M1, M2, M3, ABEF, CDGH;
+
+			// sha256rnds2 operates on the state split as {A,B,E,F} and {C,D,G,H}
+			T = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xB1);
+			S1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1B);
+			S0 = _mm_alignr_epi8(T, S1, 8);
+			S1 = _mm_blend_epi16(S1, T, 0xF0);
+
+// four rounds consuming message words m with the i-th group of round constants
+#define HASHPP_SHA256_RNDS(m, i) do {									\
+	T = _mm_add_epi32((m), _mm_load_si128(reinterpret_cast<const __m128i*>(SHA256_K + 4 * (i))));	\
+	S1 = _mm_sha256rnds2_epu32(S1, S0, T);								\
+	S0 = _mm_sha256rnds2_epu32(S0, S1, _mm_shuffle_epi32(T, 0x0E));					\
+} while(0)
+
+// next four message schedule words from the previous sixteen (a being the oldest)
+#define HASHPP_SHA256_MSG(a, b, c, d) do {								\
+	(a) = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32((a), (b)),			\
+		_mm_alignr_epi8((d), (c), 4)), (d));							\
+} while(0)
+
+			for (; blocks != 0; --blocks, data += 64) {
+				ABEF = S0;
+				CDGH = S1;
+
+				M0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), MASK);
+				M1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), MASK);
+				M2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), MASK);
+				M3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), MASK);
+
+				HASHPP_SHA256_RNDS(M0, 0);
+				HASHPP_SHA256_RNDS(M1, 1);
+				HASHPP_SHA256_RNDS(M2, 2);
+				HASHPP_SHA256_RNDS(M3, 3);
+				for (uint32_t i = 4; i < 16; i += 4) {
+					HASHPP_SHA256_MSG(M0, M1, M2, M3); HASHPP_SHA256_RNDS(M0, i);
+					HASHPP_SHA256_MSG(M1, M2, M3, M0); HASHPP_SHA256_RNDS(M1, i + 1);
+					HASHPP_SHA256_MSG(M2, M3, M0, M1); HASHPP_SHA256_RNDS(M2, i + 2);
+					HASHPP_SHA256_MSG(M3, M0, M1, M2); HASHPP_SHA256_RNDS(M3, i + 3);
+				}
+
+				S0 = _mm_add_epi32(S0, ABEF);
+				S1 = _mm_add_epi32(S1, CDGH);
+			}
+
+#undef HASHPP_SHA256_MSG
+#undef HASHPP_SHA256_RNDS
+
+			// restore the {A,B,C,D} {E,F,G,H} ordering
+			T = _mm_shuffle_epi32(S0, 0x1B);
+			S1 = _mm_shuffle_epi32(S1, 0xB1);
+			S0 = _mm_blend_epi16(T, S1, 0xF0);
+			S1 = _mm_alignr_epi8(S1, T, 8);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(state), S0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), S1);
+		}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		// sha256_ni as a single-lane multibuffer kernel
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha256_x1_ni(uint32_t* state, const uint8_t* const* blocks) {
+			sha256_ni(state, blocks[0], 1);
+		}
 
-			constexpr uint64_t F(const uint64_t A, const uint64_t B, const uint64_t C);
-			constexpr uint64_t G(const uint64_t A, const uint64_t B, const uint64_t C);
+		// SHA-256 compression of one block for each of _Lanes independent messages, with the
+		// sha256rnds2 chains of the lanes interleaved so that their latencies overlap
+		template <size_t _Lanes>
+		HASHPP_TARGET("sha,sse4.1")
+		inline void sha256_xn_ni(uint32_t* state, const uint8_t* const* blocks) {
+			const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+			__m128i S0[_Lanes], S1[_Lanes], T[_Lanes], M0[_Lanes], M1[_Lanes], M2[_Lanes], M3[_Lanes], ABEF[_Lanes], CDGH[_Lanes];
+
+			for (size_t l = 0; l < _Lanes; ++l) {
+				T[l] = _mm_set_epi32(static_cast<int>(state[2 * _Lanes + l]), static_cast<int>(state[3 * _Lanes + l]),
+					static_cast<int>(state[l]), static_cast<int>(state[_Lanes + l]));
+				S1[l] = _mm_set_epi32(static_cast<int>(state[4 * _Lanes + l]), static_cast<int>(state[5 * _Lanes + l]),
+					static_cast<int>(state[6 * _Lanes + l]), static_cast<int>(state[7 * _Lanes + l]));
+				S0[l] = _mm_alignr_epi8(T[l], S1[l], 8);
+				S1[l] = _mm_blend_epi16(S1[l], T[l], 0xF0);
+				ABEF[l] = S0[l];
+				CDGH[l] = S1[l];
+
+				M0[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l])), MASK);
+				M1[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 16)), MASK);
+				M2[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 32)), MASK);
+				M3[l] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks[l] + 48)), MASK);
+			}
+
+// four rounds of every lane consuming message words m with the i-th group of round constants
+#define HASHPP_SHA256_RNDS(m, i) do {										\
+	const __m128i K = _mm_load_si128(reinterpret_cast<const __m128i*>(SHA256_K + 4 * (i)));	\
+	for (size_t l = 0; l < _Lanes; ++l) {									\
+		T[l] = _mm_add_epi32((m)[l], K);									\
+		S1[l] = _mm_sha256rnds2_epu32(S1[l], S0[l], T[l]);						\
+	}													\
+	for (size_t l = 0; l < _Lanes; ++l) {									\
+		S0[l] = _mm_sha256rnds2_epu32(S0[l], S1[l], _mm_shuffle_epi32(T[l], 0x0E));			\
+	}													\
+} while(0)
+
+// next four message schedule words of every lane from the previous sixteen (a being the oldest)
+#define HASHPP_SHA256_MSG(a, b, c, d) do {									\
+	for (size_t l = 0; l < _Lanes; ++l) {									\
+		(a)[l] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32((a)[l], (b)[l]),		\
+			_mm_alignr_epi8((d)[l], (c)[l], 4)), (d)[l]);						\
+	}													\
+} while(0)
+
+			HASHPP_SHA256_RNDS(M0, 0);
+			HASHPP_SHA256_RNDS(M1, 1);
+			HASHPP_SHA256_RNDS(M2, 2);
+			HASHPP_SHA256_RNDS(M3, 3);
+			for (uint32_t i = 4; i < 16; i += 4) {
+				HASHPP_SHA256_MSG(M0, M1, M2, M3); HASHPP_SHA256_RNDS(M0, i);
+				HASHPP_SHA256_MSG(M1, M2, M3, M0); HASHPP_SHA256_RNDS(M1, i + 1);
+				HASHPP_SHA256_MSG(M2, M3, M0, M1); HASHPP_SHA256_RNDS(M2, i + 2);
+				HASHPP_SHA256_MSG(M3, M0, M1, M2); HASHPP_SHA256_RNDS(M3, i + 3);
+			}
+
+#undef HASHPP_SHA256_MSG
+#undef HASHPP_SHA256_RNDS
+
+			for (size_t l = 0; l < _Lanes; ++l) {
+				alignas(16) uint32_t s[8];
+				S0[l] = _mm_add_epi32(S0[l], ABEF[l]);
+				S1[l] = _mm_add_epi32(S1[l], CDGH[l]);
+
+				// restore the {A,B,C,D} {E,F,G,H} ordering before scattering back to the lane
+				T[l] = _mm_shuffle_epi32(S0[l], 0x1B);
+				S1[l] = _mm_shuffle_epi32(S1[l], 0xB1);
+				_mm_store_si128(reinterpret_cast<__m128i*>(s), _mm_blend_epi16(T[l], S1[l], 0xF0));
+				_mm_store_si128(reinterpret_cast<__m128i*>(s + 4), _mm_alignr_epi8(S1[l], T[l], 8));
+				for (size_t w = 0; w < 8; ++w) {
+					state[w * _Lanes + l] = s[w];
+				}
+			}
+		}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			constexpr uint64_t SIGMA0(const uint64_t A);
-			constexpr uint64_t SIGMA1(const uint64_t A);
-			constexpr uint64_t SIGMA2(const uint64_t A);
-			constexpr uint64_t SIGMA3(const uint64_t A);
-		};
-		class SHA2_512 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 64);
+// SHA-1 rounds shared by the single-stream SSSE3 and AVX2 kernels below; each reads
+// W + K for round i from k[i], and the register roles rotate by renaming
+#define HASHPP_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define HASHPP_SHA1_F1(b, c, d) ((d) ^ ((b) & ((c) ^ (d))))
+#define HASHPP_SHA1_F2(b, c, d) ((b) ^ (c) ^ (d))
+#define HASHPP_SHA1_F3(b, c, d) (((b) & (c)) | ((d) & ((b) | (c))))
+#define HASHPP_SHA1_ROUND(f, a, b, c, d, e, k) do {								\
+	(e) += HASHPP_ROL(a, 5) + f(b, c, d) + (k);								\
+	(b) = HASHPP_ROL(b, 30);										\
+} while(0)
+#define HASHPP_SHA1_ROUNDS(f, k) do {										\
+	HASHPP_SHA1_ROUND(f, a, b, c, d, e, (k)[0]);								\
+	HASHPP_SHA1_ROUND(f, e, a, b, c, d, (k)[1]);								\
+	HASHPP_SHA1_ROUND(f, d, e, a, b, c, (k)[2]);								\
+	HASHPP_SHA1_ROUND(f, c, d, e, a, b, (k)[3]);								\
+	HASHPP_SHA1_ROUND(f, b, c, d, e, a, (k)[4]);								\
+} while(0)
+#define HASHPP_SHA1_BLOCK(k) do {										\
+	a = state[0]; b = state[1]; c = state[2]; d = state[3]; e = state[4];					\
+	for (uint32_t i = 0; i < 20; i += 5) HASHPP_SHA1_ROUNDS(HASHPP_SHA1_F1, (k) + i);			\
+	for (uint32_t i = 20; i < 40; i += 5) HASHPP_SHA1_ROUNDS(HASHPP_SHA1_F2, (k) + i);			\
+	for (uint32_t i = 40; i < 60; i += 5) HASHPP_SHA1_ROUNDS(HASHPP_SHA1_F3, (k) + i);			\
+	for (uint32_t i = 60; i < 80; i += 5) HASHPP_SHA1_ROUNDS(HASHPP_SHA1_F2, (k) + i);			\
+	state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e;				\
+} while(0)
+
+		// single-stream SHA-1 compression for processors without the SHA extensions,
+		// expanding the message schedule four words at a time; the one word of each
+		// group that depends on the group itself (w[i+3] on w[i]) is patched in afterwards
+		HASHPP_TARGET("ssse3")
+		inline void sha1_ssse3(uint32_t state[5], const uint8_t* data, size_t blocks) {
+			const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+			alignas(16) uint32_t wk[80];
+			uint32_t a, b, c, d, e;
+
+			for (; blocks != 0; --blocks, data += 64) {
+				__m128i X[4];
+				for (uint32_t i = 0; i < 4; ++i) {
+					X[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)), MASK);
+					_mm_store_si128(reinterpret_cast<__m128i*>(wk + 4 * i), _mm_add_epi32(X[i], _mm_set1_epi32(static_cast<int>(SHA1_K[0]))));
+				}
+				for (uint32_t i = 4; i < 20; ++i) {
+					__m128i& x0 = X[i & 3];
+					const __m128i x1 = X[(i + 1) & 3], x2 = X[(i + 2) & 3], x3 = X[(i + 3) & 3];
+					const __m128i p = _mm_xor_si128(_mm_xor_si128(x0, _mm_alignr_epi8(x1, x0, 8)),
+						_mm_xor_si128(x2, _mm_srli_si128(x3, 4)));
+					const __m128i q = _mm_slli_si128(p, 12);
+					x0 = _mm_xor_si128(_mm_or_si128(_mm_slli_epi32(p, 1), _mm_srli_epi32(p, 31)),
+						_mm_or_si128(_mm_slli_epi32(q, 2), _mm_srli_epi32(q, 30)));
+					_mm_store_si128(reinterpret_cast<__m128i*>(wk + 4 * i), _mm_add_epi32(x0, _mm_set1_epi32(static_cast<int>(SHA1_K[i / 5]))));
+				}
+
+				HASHPP_SHA1_BLOCK(wk);
 			}
+		}
 
-		private:
-			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 64;
+		// AVX2 counterpart of sha1_ssse3, expanding the schedules of two consecutive
+		// blocks together (one per 128-bit half) as sha256_avx2 does
+		HASHPP_TARGET("avx2,bmi2")
+		inline void sha1_avx2(uint32_t state[5], const uint8_t* data, size_t blocks) {
+			const __m256i MASK = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+				0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+			alignas(16) uint32_t wk[2][80];	// W + K of each block
+			uint32_t a, b, c, d, e;
+
+// stores W + K of schedule group i, the low half for the first block and the high half for the second
+#define HASHPP_SHA1_WK(x, i) do {										\
+	const __m256i t = _mm256_add_epi32((x), _mm256_set1_epi32(static_cast<int>(SHA1_K[(i) / 5])));		\
+	_mm_store_si128(reinterpret_cast<__m128i*>(wk[0] + 4 * (i)), _mm256_castsi256_si128(t));		\
+	_mm_store_si128(reinterpret_cast<__m128i*>(wk[1] + 4 * (i)), _mm256_extracti128_si256(t, 1));		\
+} while(0)
+
+			while (blocks != 0) {
+				// an odd final block is expanded in both halves and only its first half used
+				const uint8_t* next = blocks > 1 ? data + 64 : data;
+				__m256i X[4];
+
+				for (uint32_t i = 0; i < 4; ++i) {
+					X[i] = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i))),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(next + 16 * i)), 1), MASK);
+					HASHPP_SHA1_WK(X[i], i);
+				}
+				for (uint32_t i = 4; i < 20; ++i) {
+					__m256i& x0 = X[i & 3];
+					const __m256i x1 = X[(i + 1) & 3], x2 = X[(i + 2) & 3], x3 = X[(i + 3) & 3];
+					const __m256i p = _mm256_xor_si256(_mm256_xor_si256(x0, _mm256_alignr_epi8(x1, x0, 8)),
+						_mm256_xor_si256(x2, _mm256_srli_si256(x3, 4)));
+					const __m256i q = _mm256_slli_si256(p, 12);
+					x0 = _mm256_xor_si256(_mm256_or_si256(_mm256_slli_epi32(p, 1), _mm256_srli_epi32(p, 31)),
+						_mm256_or_si256(_mm256_slli_epi32(q, 2), _mm256_srli_epi32(q, 30)));
+					HASHPP_SHA1_WK(x0, i);
+				}
+
+				HASHPP_SHA1_BLOCK(wk[0]);
+				if (blocks == 1) {
+					break;
+				}
+				HASHPP_SHA1_BLOCK(wk[1]);
+				blocks -= 2;
+				data += 128;
+			}
 
-			typedef struct {
-				uint64_t state[8], count[2];
-				uint8_t  data[128], digest[64];
-			} CTX;
+#undef HASHPP_SHA1_WK
+		}
 
-			CTX context = { 0 };
+#undef HASHPP_SHA1_BLOCK
+#undef HASHPP_SHA1_ROUNDS
+#undef HASHPP_SHA1_ROUND
+#undef HASHPP_SHA1_F3
+#undef HASHPP_SHA1_F2
+#undef HASHPP_SHA1_F1
+#undef HASHPP_ROL
+
+		// single-stream SHA-256 (and SHA2-224) compression for processors without the
+		// SHA extensions, in the style of Intel's AVX2 "rorx" implementation: the message
+		// schedules of two consecutive blocks are expanded together, one block per 128-bit
+		// half, then both blocks' rounds run on the scalar units with BMI2 rotates
+		HASHPP_TARGET("avx2,bmi2")
+		inline void sha256_avx2(uint32_t state[8], const uint8_t* data, size_t blocks) {
+			const __m256i MASK = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+				0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+			const __m256i LO = _mm256_set_epi64x(0, -1, 0, -1), HI = _mm256_set_epi64x(-1, 0, -1, 0);
+			alignas(32) uint32_t wk[16 * 8];	// W + K, four words of the first block then four of the second
+			uint32_t a, b, c, d, e, f, g, h, t1, t2;
+
+#define HASHPP_ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define HASHPP_VROR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+// next four schedule words of both blocks into x0 (x0 being the oldest group)
+#define HASHPP_SHA256_SCHED(x0, x1, x2, x3) do {								\
+	const __m256i w15 = _mm256_alignr_epi8((x1), (x0), 4), w7 = _mm256_alignr_epi8((x3), (x2), 4);	\
+	__m256i s = _mm256_add_epi32(_mm256_add_epi32((x0), w7), _mm256_xor_si256(_mm256_xor_si256(		\
+		HASHPP_VROR(w15, 7), HASHPP_VROR(w15, 18)), _mm256_srli_epi32(w15, 3)));			\
+	__m256i w2 = _mm256_shuffle_epi32((x3), 0xFE);								\
+	s = _mm256_add_epi32(s, _mm256_and_si256(LO, _mm256_xor_si256(_mm256_xor_si256(			\
+		HASHPP_VROR(w2, 17), HASHPP_VROR(w2, 19)), _mm256_srli_epi32(w2, 10))));			\
+	w2 = _mm256_shuffle_epi32(s, 0x40);									\
+	(x0) = _mm256_add_epi32(s, _mm256_and_si256(HI, _mm256_xor_si256(_mm256_xor_si256(			\
+		HASHPP_VROR(w2, 17), HASHPP_VROR(w2, 19)), _mm256_srli_epi32(w2, 10))));			\
+} while(0)
+
+// stores W + K of schedule group i for both blocks
+#define HASHPP_SHA256_WK(x, i)											\
+	_mm256_store_si256(reinterpret_cast<__m256i*>(wk + 8 * (i)), _mm256_add_epi32((x),			\
+		_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(SHA256_K + 4 * (i))))))
+
+#define HASHPP_SHA256_ROUND(a, b, c, d, e, f, g, h, k) do {							\
+	t1 = (h) + (HASHPP_ROR(e, 6) ^ HASHPP_ROR(e, 11) ^ HASHPP_ROR(e, 25)) + ((g) ^ ((e) & ((f) ^ (g)))) + (k);	\
+	t2 = (HASHPP_ROR(a, 2) ^ HASHPP_ROR(a, 13) ^ HASHPP_ROR(a, 22)) + (((a) & (b)) | ((c) & ((a) | (b))));	\
+	(d) += t1; (h) = t1 + t2;										\
+} while(0)
+
+// all 64 rounds of one block, reading its W + K from half 'o' (0 or 4) of wk
+#define HASHPP_SHA256_BLOCK(o) do {										\
+	a = state[0]; b = state[1]; c = state[2]; d = state[3];							\
+	e = state[4]; f = state[5]; g = state[6]; h = state[7];							\
+	for (uint32_t i = 0; i < 16; i += 2) {									\
+		const uint32_t* k = wk + 8 * i + (o);								\
+		HASHPP_SHA256_ROUND(a, b, c, d, e, f, g, h, k[0]);						\
+		HASHPP_SHA256_ROUND(h, a, b, c, d, e, f, g, k[1]);						\
+		HASHPP_SHA256_ROUND(g, h, a, b, c, d, e, f, k[2]);						\
+		HASHPP_SHA256_ROUND(f, g, h, a, b, c, d, e, k[3]);						\
+		HASHPP_SHA256_ROUND(e, f, g, h, a, b, c, d, k[8]);						\
+		HASHPP_SHA256_ROUND(d, e, f, g, h, a, b, c, k[9]);						\
+		HASHPP_SHA256_ROUND(c, d, e, f, g, h, a, b, k[10]);						\
+		HASHPP_SHA256_ROUND(b, c, d, e, f, g, h, a, k[11]);						\
+	}													\
+	state[0] += a; state[1] += b; state[2] += c; state[3] += d;						\
+	state[4] += e; state[5] += f; state[6] += g; state[7] += h;						\
+} while(0)
+
+			while (blocks != 0) {
+				// an odd final block is expanded in both halves and only its first half used
+				const uint8_t* next = blocks > 1 ? data + 64 : data;
+				__m256i X0, X1, X2, X3;
+
+				X0 = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(next)), 1), MASK);
+				X1 = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16))),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(next + 16)), 1), MASK);
+				X2 = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32))),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(next + 32)), 1), MASK);
+				X3 = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48))),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(next + 48)), 1), MASK);
+
+				HASHPP_SHA256_WK(X0, 0); HASHPP_SHA256_WK(X1, 1);
+				HASHPP_SHA256_WK(X2, 2); HASHPP_SHA256_WK(X3, 3);
+				for (uint32_t i = 4; i < 16; i += 4) {
+					HASHPP_SHA256_SCHED(X0, X1, X2, X3); HASHPP_SHA256_WK(X0, i);
+					HASHPP_SHA256_SCHED(X1, X2, X3, X0); HASHPP_SHA256_WK(X1, i + 1);
+					HASHPP_SHA256_SCHED(X2, X3, X0, X1); HASHPP_SHA256_WK(X2, i + 2);
+					HASHPP_SHA256_SCHED(X3, X0, X1, X2); HASHPP_SHA256_WK(X3, i + 3);
+				}
+
+				HASHPP_SHA256_BLOCK(0);
+				if (blocks == 1) {
+					break;
+				}
+				HASHPP_SHA256_BLOCK(4);
+				blocks -= 2;
+				data += 128;
+			}
 
-			// constants (H) defined by SHA-512 algorithm
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			const uint64_t H[8] = {
-				0x6A09E667F3BCC908,
-				0xBB67AE8584CAA73B,
-				0x3C6EF372FE94F82B,
-				0xA54FF53A5F1D36F1,
-				0x510E527FADE682D1,
-				0x9B05688C2B3E6C1F,
-				0x1F83D9ABFB41BD6B,
-				0x5BE0CD19137E2179
-			};
+#undef HASHPP_SHA256_BLOCK
+#undef HASHPP_SHA256_ROUND
+#undef HASHPP_SHA256_WK
+#undef HASHPP_SHA256_SCHED
+#undef HASHPP_VROR
+#undef HASHPP_ROR
+		}
 
-			// more constants (K)... as per above
-			const uint64_t K[80] = {
-				0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
-				0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
-				0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
-				0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
-				0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
-				0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
-				0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
-				0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
-				0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
-				0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
-				0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30,
-				0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
-				0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
-				0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
-				0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
-				0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
-				0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
-				0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
-				0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
-				0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
-			};
+		// SHA-512 (and SHA2-384, SHA2-512/t) compression for 32-bit builds, where every 64-bit
+		// add and rotate on the general-purpose registers takes a register pair and several
+		// instructions; the schedule is expanded two words at a time and the rounds run in
+		// the low 64-bit lane of SSE2 registers
+		HASHPP_TARGET("sse2")
+		inline void sha512_sse2(uint64_t state[8], const uint8_t* data, size_t blocks) {
+			alignas(16) uint64_t w[80];
+			__m128i a, b, c, d, e, f, g, h, t1, t2;
+
+#define HASHPP_VROR64(x, n) _mm_or_si128(_mm_srli_epi64((x), (n)), _mm_slli_epi64((x), 64 - (n)))
+
+#define HASHPP_SHA512_ROUND(a, b, c, d, e, f, g, h, i) do {							\
+	t1 = _mm_add_epi64(_mm_add_epi64((h), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(w + (i)))),	\
+		_mm_add_epi64(_mm_xor_si128(_mm_xor_si128(HASHPP_VROR64(e, 14), HASHPP_VROR64(e, 18)),		\
+		HASHPP_VROR64(e, 41)), _mm_xor_si128((g), _mm_and_si128((e), _mm_xor_si128((f), (g))))));	\
+	t2 = _mm_add_epi64(_mm_xor_si128(_mm_xor_si128(HASHPP_VROR64(a, 28), HASHPP_VROR64(a, 34)),		\
+		HASHPP_VROR64(a, 39)), _mm_or_si128(_mm_and_si128((a), (b)), _mm_and_si128((c), _mm_or_si128((a), (b)))));	\
+	(d) = _mm_add_epi64((d), t1); (h) = _mm_add_epi64(t1, t2);						\
+} while(0)
+
+			for (; blocks != 0; --blocks, data += 128) {
+				for (uint32_t i = 0; i < 16; ++i) {
+					GU64B(w[i], data, 8 * i);
+				}
+				for (uint32_t i = 16; i < 80; i += 2) {
+					const __m128i w15 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i - 15));
+					const __m128i w2 = _mm_load_si128(reinterpret_cast<const __m128i*>(w + i - 2));
+					_mm_store_si128(reinterpret_cast<__m128i*>(w + i), _mm_add_epi64(
+						_mm_add_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(w + i - 16)),
+							_mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i - 7))),
+						_mm_add_epi64(
+							_mm_xor_si128(_mm_xor_si128(HASHPP_VROR64(w15, 1), HASHPP_VROR64(w15, 8)), _mm_srli_epi64(w15, 7)),
+							_mm_xor_si128(_mm_xor_si128(HASHPP_VROR64(w2, 19), HASHPP_VROR64(w2, 61)), _mm_srli_epi64(w2, 6)))));
+				}
+				for (uint32_t i = 0; i < 80; i += 2) {
+					_mm_store_si128(reinterpret_cast<__m128i*>(w + i), _mm_add_epi64(
+						_mm_load_si128(reinterpret_cast<const __m128i*>(w + i)),
+						_mm_load_si128(reinterpret_cast<const __m128i*>(SHA512_K + i))));
+				}
+
+				a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state));
+				b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 1));
+				c = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 2));
+				d = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 3));
+				e = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 4));
+				f = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 5));
+				g = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 6));
+				h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(state + 7));
+				for (uint32_t i = 0; i < 80; i += 8) {
+					HASHPP_SHA512_ROUND(a, b, c, d, e, f, g, h, i);
+					HASHPP_SHA512_ROUND(h, a, b, c, d, e, f, g, i + 1);
+					HASHPP_SHA512_ROUND(g, h, a, b, c, d, e, f, i + 2);
+					HASHPP_SHA512_ROUND(f, g, h, a, b, c, d, e, i + 3);
+					HASHPP_SHA512_ROUND(e, f, g, h, a, b, c, d, i + 4);
+					HASHPP_SHA512_ROUND(d, e, f, g, h, a, b, c, i + 5);
+					HASHPP_SHA512_ROUND(c, d, e, f, g, h, a, b, i + 6);
+					HASHPP_SHA512_ROUND(b, c, d, e, f, g, h, a, i + 7);
+				}
+
+				__m128i* s = reinterpret_cast<__m128i*>(state);
+				_mm_storeu_si128(s, _mm_add_epi64(_mm_loadu_si128(s), _mm_unpacklo_epi64(a, b)));
+				_mm_storeu_si128(s + 1, _mm_add_epi64(_mm_loadu_si128(s + 1), _mm_unpacklo_epi64(c, d)));
+				_mm_storeu_si128(s + 2, _mm_add_epi64(_mm_loadu_si128(s + 2), _mm_unpacklo_epi64(e, f)));
+				_mm_storeu_si128(s + 3, _mm_add_epi64(_mm_loadu_si128(s + 3), _mm_unpacklo_epi64(g, h)));
+			}
+
+#undef HASHPP_SHA512_ROUND
+#undef HASHPP_VROR64
+		}
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+// SHA-512 schedule and rounds shared by the single-stream AVX2 and AVX-512 kernels below,
+// which differ only in how a vector rotate (HASHPP_VROR64) and three-way xor (HASHPP_VXOR3)
+// are formed; each ymm register holds four consecutive schedule words of one block
+#define HASHPP_ROR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+// next four schedule words into x0 (x0 being the oldest group); w[t+2] and w[t+3] depend
+// on w[t] and w[t+1], so sigma1 is applied to each pair in turn
+#define HASHPP_SHA512_SCHED(x0, x1, x2, x3) do {								\
+	const __m256i w15 = _mm256_permute4x64_epi64(_mm256_blend_epi32((x0), (x1), 0x03), 0x39);		\
+	const __m256i w7 = _mm256_permute4x64_epi64(_mm256_blend_epi32((x2), (x3), 0x03), 0x39);		\
+	__m256i s = _mm256_add_epi64(_mm256_add_epi64((x0), w7),						\
+		HASHPP_VXOR3(HASHPP_VROR64(w15, 1), HASHPP_VROR64(w15, 8), _mm256_srli_epi64(w15, 7)));		\
+	__m256i w2 = _mm256_permute4x64_epi64((x3), 0x0E);							\
+	s = _mm256_add_epi64(s, _mm256_blend_epi32(_mm256_setzero_si256(),					\
+		HASHPP_VXOR3(HASHPP_VROR64(w2, 19), HASHPP_VROR64(w2, 61), _mm256_srli_epi64(w2, 6)), 0x0F));	\
+	w2 = _mm256_permute4x64_epi64(s, 0x40);									\
+	(x0) = _mm256_add_epi64(s, _mm256_blend_epi32(_mm256_setzero_si256(),					\
+		HASHPP_VXOR3(HASHPP_VROR64(w2, 19), HASHPP_VROR64(w2, 61), _mm256_srli_epi64(w2, 6)), 0xF0));	\
+} while(0)
+
+#define HASHPP_SHA512_WK(x, i)											\
+	_mm256_store_si256(reinterpret_cast<__m256i*>(wk + 4 * (i)), _mm256_add_epi64((x),			\
+		_mm256_load_si256(reinterpret_cast<const __m256i*>(SHA512_K + 4 * (i)))))
+
+#define HASHPP_SHA512_ROUND(a, b, c, d, e, f, g, h, k) do {							\
+	t1 = (h) + (HASHPP_ROR64(e, 14) ^ HASHPP_ROR64(e, 18) ^ HASHPP_ROR64(e, 41)) + ((g) ^ ((e) & ((f) ^ (g)))) + (k);	\
+	t2 = (HASHPP_ROR64(a, 28) ^ HASHPP_ROR64(a, 34) ^ HASHPP_ROR64(a, 39)) + (((a) & (b)) | ((c) & ((a) | (b))));	\
+	(d) += t1; (h) = t1 + t2;										\
+} while(0)
+
+#define HASHPP_SHA512_BLOCKS() do {										\
+	const __m256i MASK = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL,			\
+		0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);							\
+	alignas(32) uint64_t wk[80];										\
+	uint64_t a, b, c, d, e, f, g, h, t1, t2;								\
+	for (; blocks != 0; --blocks, data += 128) {								\
+		__m256i X0 = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), MASK);		\
+		__m256i X1 = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32)), MASK);	\
+		__m256i X2 = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 64)), MASK);	\
+		__m256i X3 = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 96)), MASK);	\
+		HASHPP_SHA512_WK(X0, 0); HASHPP_SHA512_WK(X1, 1);						\
+		HASHPP_SHA512_WK(X2, 2); HASHPP_SHA512_WK(X3, 3);						\
+		for (uint32_t i = 4; i < 20; i += 4) {								\
+			HASHPP_SHA512_SCHED(X0, X1, X2, X3); HASHPP_SHA512_WK(X0, i);				\
+			HASHPP_SHA512_SCHED(X1, X2, X3, X0); HASHPP_SHA512_WK(X1, i + 1);			\
+			HASHPP_SHA512_SCHED(X2, X3, X0, X1); HASHPP_SHA512_WK(X2, i + 2);			\
+			HASHPP_SHA512_SCHED(X3, X0, X1, X2); HASHPP_SHA512_WK(X3, i + 3);			\
+		}												\
+		a = state[0]; b = state[1]; c = state[2]; d = state[3];						\
+		e = state[4]; f = state[5]; g = state[6]; h = state[7];						\
+		for (uint32_t i = 0; i < 80; i += 8) {								\
+			HASHPP_SHA512_ROUND(a, b, c, d, e, f, g, h, wk[i]);					\
+			HASHPP_SHA512_ROUND(h, a, b, c, d, e, f, g, wk[i + 1]);					\
+			HASHPP_SHA512_ROUND(g, h, a, b, c, d, e, f, wk[i + 2]);					\
+			HASHPP_SHA512_ROUND(f, g, h, a, b, c, d, e, wk[i + 3]);					\
+			HASHPP_SHA512_ROUND(e, f, g, h, a, b, c, d, wk[i + 4]);					\
+			HASHPP_SHA512_ROUND(d, e, f, g, h, a, b, c, wk[i + 5]);					\
+			HASHPP_SHA512_ROUND(c, d, e, f, g, h, a, b, wk[i + 6]);					\
+			HASHPP_SHA512_ROUND(b, c, d, e, f, g, h, a, wk[i + 7]);					\
+		}												\
+		state[0] += a; state[1] += b; state[2] += c; state[3] += d;					\
+		state[4] += e; state[5] += f; state[6] += g; state[7] += h;					\
+	}													\
+} while(0)
+
+		// single-stream SHA-512 (and SHA2-384, SHA2-512/t) compression, expanding the message
+		// schedule four words at a time with AVX2 and running the rounds with BMI2 rotates
+		HASHPP_TARGET("avx2,bmi2")
+		inline void sha512_avx2(uint64_t state[8], const uint8_t* data, size_t blocks) {
+#define HASHPP_VROR64(x, n) _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+#define HASHPP_VXOR3(a, b, c) _mm256_xor_si256(_mm256_xor_si256((a), (b)), (c))
+			HASHPP_SHA512_BLOCKS();
+#undef HASHPP_VXOR3
+#undef HASHPP_VROR64
+		}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+		// sha512_avx2 with the AVX-512 (VL) rotates and three-way xor
+		HASHPP_TARGET("avx2,bmi2,avx512f,avx512vl")
+		inline void sha512_avx512(uint64_t state[8], const uint8_t* data, size_t blocks) {
+#define HASHPP_VROR64(x, n) _mm256_ror_epi64((x), (n))
+#define HASHPP_VXOR3(a, b, c) _mm256_ternarylogic_epi64((a), (b), (c), 0x96)
+			HASHPP_SHA512_BLOCKS();
+#undef HASHPP_VXOR3
+#undef HASHPP_VROR64
+		}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+#undef HASHPP_SHA512_BLOCKS
+#undef HASHPP_SHA512_ROUND
+#undef HASHPP_SHA512_WK
+#undef HASHPP_SHA512_SCHED
+#undef HASHPP_ROR64
+
+		// transposes eight rows of eight 32-bit words, so that r[i] holds word i of every row
+		HASHPP_TARGET("avx2")
+		inline void transpose8x32(__m256i r[8]) {
+			__m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]), t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+			__m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]), t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+			__m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]), t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+			__m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]), t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+			__m256i u0 = _mm256_unpacklo_epi64(t0, t2), u1 = _mm256_unpackhi_epi64(t0, t2);
+			__m256i u2 = _mm256_unpacklo_epi64(t1, t3), u3 = _mm256_unpackhi_epi64(t1, t3);
+			__m256i u4 = _mm256_unpacklo_epi64(t4, t6), u5 = _mm256_unpackhi_epi64(t4, t6);
+			__m256i u6 = _mm256_unpacklo_epi64(t5, t7), u7 = _mm256_unpackhi_epi64(t5, t7);
+
+			r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+			r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+			r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+			r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+			r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+			r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+			r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+			r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+		}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		// MD4 compression of one 64-byte block from each of eight independent
+		// messages, one message per 32-bit AVX2 lane (word-major state, see multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void md4_x8_avx2(uint32_t* state, const uint8_t* const* blocks) {
+			__m256i M[16], r[8];
 
-			constexpr uint64_t F(const uint64_t A, const uint64_t B, const uint64_t C);
-			constexpr uint64_t G(const uint64_t A, const uint64_t B, const uint64_t C);
+			for (uint32_t half = 0; half < 2; ++half) {
+				for (uint32_t l = 0; l < 8; ++l) {
+					r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + half * 32));
+				}
+				transpose8x32(r);
+				for (uint32_t i = 0; i < 8; ++i) {
+					M[half * 8 + i] = r[i];
+				}
+			}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			constexpr uint64_t SIGMA0(const uint64_t A);
-			constexpr uint64_t SIGMA1(const uint64_t A);
-			constexpr uint64_t SIGMA2(const uint64_t A);
-			constexpr uint64_t SIGMA3(const uint64_t A);
-		};
-		class SHA2_512_224 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 28);
+			const __m256i A = _mm256_load_si256(reinterpret_cast<const __m256i*>(state));
+			const __m256i B = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 8));
+			const __m256i C = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 16));
+			const __m256i D = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 24));
+			const __m256i K1 = _mm256_set1_epi32(0x5a827999), K2 = _mm256_set1_epi32(0x6ed9eba1);
+			__m256i a = A, b = B, c = C, d = D;
+
+#define HASHPP_MD4_F(x, y, z) _mm256_xor_si256((z), _mm256_and_si256((x), _mm256_xor_si256((y), (z))))
+#define HASHPP_MD4_G(x, y, z) _mm256_add_epi32(_mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y)))), K1)
+#define HASHPP_MD4_H(x, y, z) _mm256_add_epi32(_mm256_xor_si256(_mm256_xor_si256((x), (y)), (z)), K2)
+#define HASHPP_MD4_STEP(fn, a, b, c, d, k, s) do {										\
+				const __m256i t = _mm256_add_epi32(_mm256_add_epi32((a), fn((b), (c), (d))), M[k]);	\
+				(a) = _mm256_or_si256(_mm256_slli_epi32(t, (s)), _mm256_srli_epi32(t, 32 - (s)));	\
+			} while (0)
+
+			for (uint32_t i = 0; i < 16; i += 4) {
+				HASHPP_MD4_STEP(HASHPP_MD4_F, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(HASHPP_MD4_F, d, a, b, c, i + 1, 7);
+				HASHPP_MD4_STEP(HASHPP_MD4_F, c, d, a, b, i + 2, 11);
+				HASHPP_MD4_STEP(HASHPP_MD4_F, b, c, d, a, i + 3, 19);
 			}
+			for (uint32_t i = 0; i < 4; ++i) {
+				HASHPP_MD4_STEP(HASHPP_MD4_G, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(HASHPP_MD4_G, d, a, b, c, i + 4, 5);
+				HASHPP_MD4_STEP(HASHPP_MD4_G, c, d, a, b, i + 8, 9);
+				HASHPP_MD4_STEP(HASHPP_MD4_G, b, c, d, a, i + 12, 13);
+			}
+			for (uint32_t i : { 0, 2, 1, 3 }) {
+				HASHPP_MD4_STEP(HASHPP_MD4_H, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(HASHPP_MD4_H, d, a, b, c, i + 8, 9);
+				HASHPP_MD4_STEP(HASHPP_MD4_H, c, d, a, b, i + 4, 11);
+				HASHPP_MD4_STEP(HASHPP_MD4_H, b, c, d, a, i + 12, 15);
+			}
+
+#undef HASHPP_MD4_STEP
+#undef HASHPP_MD4_H
+#undef HASHPP_MD4_G
+#undef HASHPP_MD4_F
+
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state), _mm256_add_epi32(A, a));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 8), _mm256_add_epi32(B, b));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 16), _mm256_add_epi32(C, c));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 24), _mm256_add_epi32(D, d));
+		}
 
-		private:
-			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 28;
+		// MD5 compression of one 64-byte block from each of eight independent
+		// messages, one message per 32-bit AVX2 lane (word-major state, see multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void md5_x8_avx2(uint32_t* state, const uint8_t* const* blocks) {
+			__m256i M[16], r[8];
+
+			for (uint32_t half = 0; half < 2; ++half) {
+				for (uint32_t l = 0; l < 8; ++l) {
+					r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + half * 32));
+				}
+				transpose8x32(r);
+				for (uint32_t i = 0; i < 8; ++i) {
+					M[half * 8 + i] = r[i];
+				}
+			}
+
+			const __m256i A = _mm256_load_si256(reinterpret_cast<const __m256i*>(state));
+			const __m256i B = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 8));
+			const __m256i C = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 16));
+			const __m256i D = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 24));
+			const __m256i ONES = _mm256_set1_epi32(-1);
+			__m256i a = A, b = B, c = C, d = D;
+
+#define HASHPP_MD5_F(x, y, z) _mm256_xor_si256((z), _mm256_and_si256((x), _mm256_xor_si256((y), (z))))
+#define HASHPP_MD5_G(x, y, z) _mm256_xor_si256((y), _mm256_and_si256((z), _mm256_xor_si256((x), (y))))
+#define HASHPP_MD5_H(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+#define HASHPP_MD5_I(x, y, z) _mm256_xor_si256((y), _mm256_or_si256((x), _mm256_xor_si256((z), ONES)))
+#define HASHPP_MD5_STEP(fn, a, b, c, d, g, s, i) do {									\
+				const __m256i t = _mm256_add_epi32(_mm256_add_epi32((a), fn((b), (c), (d))),	\
+					_mm256_add_epi32(M[g], _mm256_set1_epi32(static_cast<int>(MD5_K[i]))));	\
+				(a) = _mm256_add_epi32((b), _mm256_or_si256(_mm256_slli_epi32(t, (s)), _mm256_srli_epi32(t, 32 - (s))));	\
+			} while (0)
+
+			for (uint32_t i = 0; i < 16; i += 4) {
+				HASHPP_MD5_STEP(HASHPP_MD5_F, a, b, c, d, i, 7, i);
+				HASHPP_MD5_STEP(HASHPP_MD5_F, d, a, b, c, i + 1, 12, i + 1);
+				HASHPP_MD5_STEP(HASHPP_MD5_F, c, d, a, b, i + 2, 17, i + 2);
+				HASHPP_MD5_STEP(HASHPP_MD5_F, b, c, d, a, i + 3, 22, i + 3);
+			}
+			for (uint32_t i = 16; i < 32; i += 4) {
+				HASHPP_MD5_STEP(HASHPP_MD5_G, a, b, c, d, (5 * i + 1) & 15, 5, i);
+				HASHPP_MD5_STEP(HASHPP_MD5_G, d, a, b, c, (5 * i + 6) & 15, 9, i + 1);
+				HASHPP_MD5_STEP(HASHPP_MD5_G, c, d, a, b, (5 * i + 11) & 15, 14, i + 2);
+				HASHPP_MD5_STEP(HASHPP_MD5_G, b, c, d, a, (5 * i) & 15, 20, i + 3);
+			}
+			for (uint32_t i = 32; i < 48; i += 4) {
+				HASHPP_MD5_STEP(HASHPP_MD5_H, a, b, c, d, (3 * i + 5) & 15, 4, i);
+				HASHPP_MD5_STEP(HASHPP_MD5_H, d, a, b, c, (3 * i + 8) & 15, 11, i + 1);
+				HASHPP_MD5_STEP(HASHPP_MD5_H, c, d, a, b, (3 * i + 11) & 15, 16, i + 2);
+				HASHPP_MD5_STEP(HASHPP_MD5_H, b, c, d, a, (3 * i + 14) & 15, 23, i + 3);
+			}
+			for (uint32_t i = 48; i < 64; i += 4) {
+				HASHPP_MD5_STEP(HASHPP_MD5_I, a, b, c, d, (7 * i) & 15, 6, i);
+				HASHPP_MD5_STEP(HASHPP_MD5_I, d, a, b, c, (7 * i + 7) & 15, 10, i + 1);
+				HASHPP_MD5_STEP(HASHPP_MD5_I, c, d, a, b, (7 * i + 14) & 15, 15, i + 2);
+				HASHPP_MD5_STEP(HASHPP_MD5_I, b, c, d, a, (7 * i + 21) & 15, 21, i + 3);
+			}
+
+#undef HASHPP_MD5_STEP
+#undef HASHPP_MD5_I
+#undef HASHPP_MD5_H
+#undef HASHPP_MD5_G
+#undef HASHPP_MD5_F
+
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state), _mm256_add_epi32(A, a));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 8), _mm256_add_epi32(B, b));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 16), _mm256_add_epi32(C, c));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(state + 24), _mm256_add_epi32(D, d));
+		}
 
-			typedef struct {
-				uint64_t state[8], count[2];
-				uint8_t  data[128], digest[32];
-			} CTX;
+		// SHA-1 compression of one 64-byte block from each of eight independent
+		// messages, one message per 32-bit AVX2 lane (word-major state, see multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void sha1_x8_avx2(uint32_t* state, const uint8_t* const* blocks) {
+			const __m256i SWAP = _mm256_set_epi8(
+				12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+				12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+			__m256i W[16], S[5], r[8];
 
-			CTX context = { 0 };
+			for (uint32_t half = 0; half < 2; ++half) {
+				for (uint32_t l = 0; l < 8; ++l) {
+					r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + half * 32));
+				}
+				transpose8x32(r);
+				for (uint32_t i = 0; i < 8; ++i) {
+					W[half * 8 + i] = _mm256_shuffle_epi8(r[i], SWAP);
+				}
+			}
 
-			// constants (H) defined by SHA-512/224 algorithm
-			// as per: https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHA512_224.pdf
-			const uint64_t H[8] = {
-				0x8C3D37C819544DA2,
-				0x73E1996689DCD4D6,
+			for (uint32_t i = 0; i < 5; ++i) {
+				S[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + i * 8));
+			}
+
+#define HASHPP_ROL32x8(x, n) _mm256_or_si256(_mm256_slli_epi32((x), (n)), _mm256_srli_epi32((x), 32 - (n)))
+#define HASHPP_SHA1_W(i) ((i) < 16 ? W[i] : (W[(i) & 15] = HASHPP_ROL32x8(_mm256_xor_si256(_mm256_xor_si256(W[((i) - 3) & 15], W[((i) - 8) & 15]),	\
+				_mm256_xor_si256(W[((i) - 14) & 15], W[(i) & 15])), 1)))
+#define HASHPP_SHA1_STEP(f, k, i) do {																	\
+				const __m256i t = _mm256_add_epi32(_mm256_add_epi32(HASHPP_ROL32x8(a, 5), (f)), _mm256_add_epi32(_mm256_add_epi32(e, (k)), HASHPP_SHA1_W(i)));	\
+				e = d; d = c; c = HASHPP_ROL32x8(b, 30); b = a; a = t;												\
+			} while (0)
+
+			__m256i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4];
+			const __m256i K0 = _mm256_set1_epi32(0x5a827999), K1 = _mm256_set1_epi32(0x6ed9eba1);
+			const __m256i K2 = _mm256_set1_epi32(static_cast<int>(0x8f1bbcdc)), K3 = _mm256_set1_epi32(static_cast<int>(0xca62c1d6));
+			for (uint32_t i = 0; i < 20; ++i) {
+				HASHPP_SHA1_STEP(_mm256_xor_si256(d, _mm256_and_si256(b, _mm256_xor_si256(c, d))), K0, i);
+			}
+			for (uint32_t i = 20; i < 40; ++i) {
+				HASHPP_SHA1_STEP(_mm256_xor_si256(_mm256_xor_si256(b, c), d), K1, i);
+			}
+			for (uint32_t i = 40; i < 60; ++i) {
+				HASHPP_SHA1_STEP(_mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(d, _mm256_or_si256(b, c))), K2, i);
+			}
+			for (uint32_t i = 60; i < 80; ++i) {
+				HASHPP_SHA1_STEP(_mm256_xor_si256(_mm256_xor_si256(b, c), d), K3, i);
+			}
+
+#undef HASHPP_SHA1_STEP
+#undef HASHPP_SHA1_W
+#undef HASHPP_ROL32x8
+
+			S[0] = _mm256_add_epi32(S[0], a); S[1] = _mm256_add_epi32(S[1], b); S[2] = _mm256_add_epi32(S[2], c);
+			S[3] = _mm256_add_epi32(S[3], d); S[4] = _mm256_add_epi32(S[4], e);
+			for (uint32_t i = 0; i < 5; ++i) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state + i * 8), S[i]);
+			}
+		}
+
+		// SHA-256 compression of one 64-byte block from each of eight independent
+		// messages, one message per 32-bit AVX2 lane (word-major state, see multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void sha256_x8_avx2(uint32_t* state, const uint8_t* const* blocks) {
+			const __m256i SWAP = _mm256_set_epi8(
+				12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+				12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+			__m256i W[16], S[8], r[8];
+
+			for (uint32_t half = 0; half < 2; ++half) {
+				for (uint32_t l = 0; l < 8; ++l) {
+					r[l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[l] + half * 32));
+				}
+				transpose8x32(r);
+				for (uint32_t i = 0; i < 8; ++i) {
+					W[half * 8 + i] = _mm256_shuffle_epi8(r[i], SWAP);
+				}
+			}
+
+			for (uint32_t i = 0; i < 8; ++i) {
+				S[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + i * 8));
+			}
+
+#define HASHPP_ROR32x8(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+			__m256i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4], f = S[5], g = S[6], h = S[7];
+			for (uint32_t i = 0; i < 64; ++i) {
+				__m256i w;
+				if (i < 16) {
+					w = W[i];
+				}
+				else {
+					const __m256i w2 = W[(i - 2) & 15], w15 = W[(i - 15) & 15];
+					const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR32x8(w2, 17), HASHPP_ROR32x8(w2, 19)), _mm256_srli_epi32(w2, 10));
+					const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR32x8(w15, 7), HASHPP_ROR32x8(w15, 18)), _mm256_srli_epi32(w15, 3));
+					w = _mm256_add_epi32(_mm256_add_epi32(s1, W[(i - 7) & 15]), _mm256_add_epi32(s0, W[i & 15]));
+					W[i & 15] = w;
+				}
+
+				const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR32x8(e, 6), HASHPP_ROR32x8(e, 11)), HASHPP_ROR32x8(e, 25));
+				const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+				const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, w)),
+					_mm256_set1_epi32(static_cast<int>(SHA256_K[i])));
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR32x8(a, 2), HASHPP_ROR32x8(a, 13)), HASHPP_ROR32x8(a, 22));
+				const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+
+				h = g; g = f; f = e;
+				e = _mm256_add_epi32(d, t1);
+				d = c; c = b; b = a;
+				a = _mm256_add_epi32(t1, _mm256_add_epi32(S0, maj));
+			}
+
+#undef HASHPP_ROR32x8
+
+			S[0] = _mm256_add_epi32(S[0], a); S[1] = _mm256_add_epi32(S[1], b);
+			S[2] = _mm256_add_epi32(S[2], c); S[3] = _mm256_add_epi32(S[3], d);
+			S[4] = _mm256_add_epi32(S[4], e); S[5] = _mm256_add_epi32(S[5], f);
+			S[6] = _mm256_add_epi32(S[6], g); S[7] = _mm256_add_epi32(S[7], h);
+			for (uint32_t i = 0; i < 8; ++i) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state + i * 8), S[i]);
+			}
+		}
+
+		// SHA-512 compression of one 128-byte block from each of four independent
+		// messages, one message per 64-bit AVX2 lane (word-major state, see multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void sha512_x4_avx2(uint64_t* state, const uint8_t* const* blocks) {
+			const __m256i SWAP = _mm256_set_epi8(
+				8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+				8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+			__m256i W[16], S[8];
+
+			// 4x4 transposes of 64-bit words, four message words at a time
+			for (uint32_t q = 0; q < 4; ++q) {
+				const __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[0] + q * 32));
+				const __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[1] + q * 32));
+				const __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[2] + q * 32));
+				const __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[3] + q * 32));
+				const __m256i t0 = _mm256_unpacklo_epi64(r0, r1), t1 = _mm256_unpackhi_epi64(r0, r1);
+				const __m256i t2 = _mm256_unpacklo_epi64(r2, r3), t3 = _mm256_unpackhi_epi64(r2, r3);
+				W[q * 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t2, 0x20), SWAP);
+				W[q * 4 + 1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t3, 0x20), SWAP);
+				W[q * 4 + 2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0, t2, 0x31), SWAP);
+				W[q * 4 + 3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1, t3, 0x31), SWAP);
+			}
+
+			for (uint32_t i = 0; i < 8; ++i) {
+				S[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + i * 4));
+			}
+
+#define HASHPP_ROR64x4(x, n) _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+
+			__m256i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4], f = S[5], g = S[6], h = S[7];
+			for (uint32_t i = 0; i < 80; ++i) {
+				__m256i w;
+				if (i < 16) {
+					w = W[i];
+				}
+				else {
+					const __m256i w2 = W[(i - 2) & 15], w15 = W[(i - 15) & 15];
+					const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR64x4(w2, 19), HASHPP_ROR64x4(w2, 61)), _mm256_srli_epi64(w2, 6));
+					const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR64x4(w15, 1), HASHPP_ROR64x4(w15, 8)), _mm256_srli_epi64(w15, 7));
+					w = _mm256_add_epi64(_mm256_add_epi64(s1, W[(i - 7) & 15]), _mm256_add_epi64(s0, W[i & 15]));
+					W[i & 15] = w;
+				}
+
+				const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR64x4(e, 14), HASHPP_ROR64x4(e, 18)), HASHPP_ROR64x4(e, 41));
+				const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+				const __m256i t1 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(h, S1), _mm256_add_epi64(ch, w)),
+					_mm256_set1_epi64x(static_cast<long long>(SHA512_K[i])));
+				const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(HASHPP_ROR64x4(a, 28), HASHPP_ROR64x4(a, 34)), HASHPP_ROR64x4(a, 39));
+				const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+
+				h = g; g = f; f = e;
+				e = _mm256_add_epi64(d, t1);
+				d = c; c = b; b = a;
+				a = _mm256_add_epi64(t1, _mm256_add_epi64(S0, maj));
+			}
+
+#undef HASHPP_ROR64x4
+
+			S[0] = _mm256_add_epi64(S[0], a); S[1] = _mm256_add_epi64(S[1], b);
+			S[2] = _mm256_add_epi64(S[2], c); S[3] = _mm256_add_epi64(S[3], d);
+			S[4] = _mm256_add_epi64(S[4], e); S[5] = _mm256_add_epi64(S[5], f);
+			S[6] = _mm256_add_epi64(S[6], g); S[7] = _mm256_add_epi64(S[7], h);
+			for (uint32_t i = 0; i < 8; ++i) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(state + i * 4), S[i]);
+			}
+		}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+		// transposes sixteen rows of sixteen 32-bit words, so that r[i] holds word i of every row
+		HASHPP_TARGET("avx512f")
+		inline void transpose16x32(__m512i r[16]) {
+			__m512i t[16], u[16];
+
+			for (uint32_t i = 0; i < 16; i += 2) {
+				t[i] = _mm512_unpacklo_epi32(r[i], r[i + 1]);
+				t[i + 1] = _mm512_unpackhi_epi32(r[i], r[i + 1]);
+			}
+
+			// u[4 * g + k] holds, per 128-bit lane j, word (k + 4 * j) of rows 4 * g through 4 * g + 3
+			for (uint32_t i = 0; i < 16; i += 4) {
+				u[i] = _mm512_unpacklo_epi64(t[i], t[i + 2]);
+				u[i + 1] = _mm512_unpackhi_epi64(t[i], t[i + 2]);
+				u[i + 2] = _mm512_unpacklo_epi64(t[i + 1], t[i + 3]);
+				u[i + 3] = _mm512_unpackhi_epi64(t[i + 1], t[i + 3]);
+			}
+
+			for (uint32_t k = 0; k < 4; ++k) {
+				const __m512i x0 = _mm512_shuffle_i32x4(u[k], u[k + 4], 0x44), x1 = _mm512_shuffle_i32x4(u[k], u[k + 4], 0xEE);
+				const __m512i y0 = _mm512_shuffle_i32x4(u[k + 8], u[k + 12], 0x44), y1 = _mm512_shuffle_i32x4(u[k + 8], u[k + 12], 0xEE);
+				r[k] = _mm512_shuffle_i32x4(x0, y0, 0x88);
+				r[k + 4] = _mm512_shuffle_i32x4(x0, y0, 0xDD);
+				r[k + 8] = _mm512_shuffle_i32x4(x1, y1, 0x88);
+				r[k + 12] = _mm512_shuffle_i32x4(x1, y1, 0xDD);
+			}
+		}
+
+		// SHA-256 compression of one 64-byte block from each of sixteen independent
+		// messages, one message per 32-bit AVX-512 lane, using vprord rotates and
+		// vpternlogd for the three-input boolean and XOR functions
+		HASHPP_TARGET("avx512f,avx512bw")
+		inline void sha256_x16_avx512(uint32_t* state, const uint8_t* const* blocks) {
+			const __m512i SWAP = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+			__m512i W[16], S[8];
+
+			for (uint32_t l = 0; l < 16; ++l) {
+				W[l] = _mm512_loadu_si512(blocks[l]);
+			}
+			transpose16x32(W);
+			for (uint32_t i = 0; i < 16; ++i) {
+				W[i] = _mm512_shuffle_epi8(W[i], SWAP);
+			}
+
+			for (uint32_t i = 0; i < 8; ++i) {
+				S[i] = _mm512_load_si512(state + i * 16);
+			}
+
+			__m512i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4], f = S[5], g = S[6], h = S[7];
+			for (uint32_t i = 0; i < 64; ++i) {
+				__m512i w;
+				if (i < 16) {
+					w = W[i];
+				}
+				else {
+					const __m512i w2 = W[(i - 2) & 15], w15 = W[(i - 15) & 15];
+					const __m512i s1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w2, 17), _mm512_ror_epi32(w2, 19), _mm512_srli_epi32(w2, 10), 0x96);
+					const __m512i s0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w15, 7), _mm512_ror_epi32(w15, 18), _mm512_srli_epi32(w15, 3), 0x96);
+					w = _mm512_add_epi32(_mm512_add_epi32(s1, W[(i - 7) & 15]), _mm512_add_epi32(s0, W[i & 15]));
+					W[i & 15] = w;
+				}
+
+				// 0xCA => e ? f : g (Ch), 0xE8 => majority (Maj), 0x96 => three-way XOR
+				const __m512i S1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(e, 6), _mm512_ror_epi32(e, 11), _mm512_ror_epi32(e, 25), 0x96);
+				const __m512i t1 = _mm512_add_epi32(_mm512_add_epi32(_mm512_add_epi32(h, S1), _mm512_add_epi32(_mm512_ternarylogic_epi32(e, f, g, 0xCA), w)),
+					_mm512_set1_epi32(static_cast<int>(SHA256_K[i])));
+				const __m512i S0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(a, 2), _mm512_ror_epi32(a, 13), _mm512_ror_epi32(a, 22), 0x96);
+				const __m512i t2 = _mm512_add_epi32(S0, _mm512_ternarylogic_epi32(a, b, c, 0xE8));
+
+				h = g; g = f; f = e;
+				e = _mm512_add_epi32(d, t1);
+				d = c; c = b; b = a;
+				a = _mm512_add_epi32(t1, t2);
+			}
+
+			S[0] = _mm512_add_epi32(S[0], a); S[1] = _mm512_add_epi32(S[1], b);
+			S[2] = _mm512_add_epi32(S[2], c); S[3] = _mm512_add_epi32(S[3], d);
+			S[4] = _mm512_add_epi32(S[4], e); S[5] = _mm512_add_epi32(S[5], f);
+			S[6] = _mm512_add_epi32(S[6], g); S[7] = _mm512_add_epi32(S[7], h);
+			for (uint32_t i = 0; i < 8; ++i) {
+				_mm512_store_si512(state + i * 16, S[i]);
+			}
+		}
+
+		// SHA-512 compression of one 128-byte block from each of eight independent
+		// messages, one message per 64-bit AVX-512 lane, using vprorq rotates and
+		// vpternlogq for the three-input boolean and XOR functions
+		HASHPP_TARGET("avx512f,avx512bw")
+		inline void sha512_x8_avx512(uint64_t* state, const uint8_t* const* blocks) {
+			const __m512i SWAP = _mm512_set4_epi32(0x08090a0b, 0x0c0d0e0f, 0x00010203, 0x04050607);
+			__m512i W[16], S[8];
+
+			// 8x8 transposes of 64-bit words, eight message words at a time; after
+			// the unpacks t[2 * p] and t[2 * p + 1] hold, per 128-bit lane j, words
+			// 2 * j and 2 * j + 1 of rows 2 * p and 2 * p + 1
+			for (uint32_t half = 0; half < 2; ++half) {
+				__m512i t[8];
+				for (uint32_t p = 0; p < 4; ++p) {
+					const __m512i r0 = _mm512_loadu_si512(blocks[2 * p] + half * 64);
+					const __m512i r1 = _mm512_loadu_si512(blocks[2 * p + 1] + half * 64);
+					t[2 * p] = _mm512_unpacklo_epi64(r0, r1);
+					t[2 * p + 1] = _mm512_unpackhi_epi64(r0, r1);
+				}
+				for (uint32_t k = 0; k < 2; ++k) {
+					const __m512i x0 = _mm512_shuffle_i64x2(t[k], t[k + 2], 0x44), x1 = _mm512_shuffle_i64x2(t[k], t[k + 2], 0xEE);
+					const __m512i y0 = _mm512_shuffle_i64x2(t[k + 4], t[k + 6], 0x44), y1 = _mm512_shuffle_i64x2(t[k + 4], t[k + 6], 0xEE);
+					W[half * 8 + k] = _mm512_shuffle_epi8(_mm512_shuffle_i64x2(x0, y0, 0x88), SWAP);
+					W[half * 8 + k + 2] = _mm512_shuffle_epi8(_mm512_shuffle_i64x2(x0, y0, 0xDD), SWAP);
+					W[half * 8 + k + 4] = _mm512_shuffle_epi8(_mm512_shuffle_i64x2(x1, y1, 0x88), SWAP);
+					W[half * 8 + k + 6] = _mm512_shuffle_epi8(_mm512_shuffle_i64x2(x1, y1, 0xDD), SWAP);
+				}
+			}
+
+			for (uint32_t i = 0; i < 8; ++i) {
+				S[i] = _mm512_load_si512(state + i * 8);
+			}
+
+			__m512i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4], f = S[5], g = S[6], h = S[7];
+			for (uint32_t i = 0; i < 80; ++i) {
+				__m512i w;
+				if (i < 16) {
+					w = W[i];
+				}
+				else {
+					const __m512i w2 = W[(i - 2) & 15], w15 = W[(i - 15) & 15];
+					const __m512i s1 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w2, 19), _mm512_ror_epi64(w2, 61), _mm512_srli_epi64(w2, 6), 0x96);
+					const __m512i s0 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w15, 1), _mm512_ror_epi64(w15, 8), _mm512_srli_epi64(w15, 7), 0x96);
+					w = _mm512_add_epi64(_mm512_add_epi64(s1, W[(i - 7) & 15]), _mm512_add_epi64(s0, W[i & 15]));
+					W[i & 15] = w;
+				}
+
+				const __m512i S1 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(e, 14), _mm512_ror_epi64(e, 18), _mm512_ror_epi64(e, 41), 0x96);
+				const __m512i t1 = _mm512_add_epi64(_mm512_add_epi64(_mm512_add_epi64(h, S1), _mm512_add_epi64(_mm512_ternarylogic_epi64(e, f, g, 0xCA), w)),
+					_mm512_set1_epi64(static_cast<long long>(SHA512_K[i])));
+				const __m512i S0 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(a, 28), _mm512_ror_epi64(a, 34), _mm512_ror_epi64(a, 39), 0x96);
+				const __m512i t2 = _mm512_add_epi64(S0, _mm512_ternarylogic_epi64(a, b, c, 0xE8));
+
+				h = g; g = f; f = e;
+				e = _mm512_add_epi64(d, t1);
+				d = c; c = b; b = a;
+				a = _mm512_add_epi64(t1, t2);
+			}
+
+			S[0] = _mm512_add_epi64(S[0], a); S[1] = _mm512_add_epi64(S[1], b);
+			S[2] = _mm512_add_epi64(S[2], c); S[3] = _mm512_add_epi64(S[3], d);
+			S[4] = _mm512_add_epi64(S[4], e); S[5] = _mm512_add_epi64(S[5], f);
+			S[6] = _mm512_add_epi64(S[6], g); S[7] = _mm512_add_epi64(S[7], h);
+			for (uint32_t i = 0; i < 8; ++i) {
+				_mm512_store_si512(state + i * 8, S[i]);
+			}
+		}
+
+		// MD4 compression of one 64-byte block from each of sixteen independent
+		// messages, one message per 32-bit AVX-512 lane, using vprold rotates and
+		// vpternlogd for the round functions
+		HASHPP_TARGET("avx512f")
+		inline void md4_x16_avx512(uint32_t* state, const uint8_t* const* blocks) {
+			__m512i M[16];
+
+			for (uint32_t l = 0; l < 16; ++l) {
+				M[l] = _mm512_loadu_si512(blocks[l]);
+			}
+			transpose16x32(M);
+
+			const __m512i A = _mm512_load_si512(state), B = _mm512_load_si512(state + 16);
+			const __m512i C = _mm512_load_si512(state + 32), D = _mm512_load_si512(state + 48);
+			const __m512i K0 = _mm512_setzero_si512(), K1 = _mm512_set1_epi32(0x5a827999), K2 = _mm512_set1_epi32(0x6ed9eba1);
+			__m512i a = A, b = B, c = C, d = D;
+
+			// 0xCA => x ? y : z (F), 0xE8 => majority (G), 0x96 => three-way XOR (H)
+#define HASHPP_MD4_STEP(imm, k0, a, b, c, d, k, s) do {										\
+				const __m512i t = _mm512_add_epi32(_mm512_add_epi32((a), _mm512_ternarylogic_epi32((b), (c), (d), (imm))),	\
+					_mm512_add_epi32(M[k], (k0)));											\
+				(a) = _mm512_rol_epi32(t, (s));											\
+			} while (0)
+
+			for (uint32_t i = 0; i < 16; i += 4) {
+				HASHPP_MD4_STEP(0xCA, K0, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(0xCA, K0, d, a, b, c, i + 1, 7);
+				HASHPP_MD4_STEP(0xCA, K0, c, d, a, b, i + 2, 11);
+				HASHPP_MD4_STEP(0xCA, K0, b, c, d, a, i + 3, 19);
+			}
+			for (uint32_t i = 0; i < 4; ++i) {
+				HASHPP_MD4_STEP(0xE8, K1, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(0xE8, K1, d, a, b, c, i + 4, 5);
+				HASHPP_MD4_STEP(0xE8, K1, c, d, a, b, i + 8, 9);
+				HASHPP_MD4_STEP(0xE8, K1, b, c, d, a, i + 12, 13);
+			}
+			for (uint32_t i : { 0, 2, 1, 3 }) {
+				HASHPP_MD4_STEP(0x96, K2, a, b, c, d, i, 3);
+				HASHPP_MD4_STEP(0x96, K2, d, a, b, c, i + 8, 9);
+				HASHPP_MD4_STEP(0x96, K2, c, d, a, b, i + 4, 11);
+				HASHPP_MD4_STEP(0x96, K2, b, c, d, a, i + 12, 15);
+			}
+
+#undef HASHPP_MD4_STEP
+
+			_mm512_store_si512(state, _mm512_add_epi32(A, a));
+			_mm512_store_si512(state + 16, _mm512_add_epi32(B, b));
+			_mm512_store_si512(state + 32, _mm512_add_epi32(C, c));
+			_mm512_store_si512(state + 48, _mm512_add_epi32(D, d));
+		}
+
+		// MD5 compression of one 64-byte block from each of sixteen independent
+		// messages, one message per 32-bit AVX-512 lane, using vprold rotates and
+		// vpternlogd for the round functions
+		HASHPP_TARGET("avx512f")
+		inline void md5_x16_avx512(uint32_t* state, const uint8_t* const* blocks) {
+			__m512i M[16];
+
+			for (uint32_t l = 0; l < 16; ++l) {
+				M[l] = _mm512_loadu_si512(blocks[l]);
+			}
+			transpose16x32(M);
+
+			const __m512i A = _mm512_load_si512(state), B = _mm512_load_si512(state + 16);
+			const __m512i C = _mm512_load_si512(state + 32), D = _mm512_load_si512(state + 48);
+			__m512i a = A, b = B, c = C, d = D;
+
+			// 0xCA => x ? y : z (F, and G with its operands rotated), 0x96 => three-way XOR (H),
+			// 0x39 => y ^ (x | ~z) (I)
+#define HASHPP_MD5_STEP(imm, a, b, c, d, g, s, i) do {										\
+				const __m512i t = _mm512_add_epi32(_mm512_add_epi32((a), _mm512_ternarylogic_epi32((b), (c), (d), (imm))),	\
+					_mm512_add_epi32(M[g], _mm512_set1_epi32(static_cast<int>(MD5_K[i]))));		\
+				(a) = _mm512_add_epi32((b), _mm512_rol_epi32(t, (s)));							\
+			} while (0)
+#define HASHPP_MD5_GSTEP(a, b, c, d, g, s, i) do {											\
+				const __m512i t = _mm512_add_epi32(_mm512_add_epi32((a), _mm512_ternarylogic_epi32((d), (b), (c), 0xCA)),	\
+					_mm512_add_epi32(M[g], _mm512_set1_epi32(static_cast<int>(MD5_K[i]))));		\
+				(a) = _mm512_add_epi32((b), _mm512_rol_epi32(t, (s)));							\
+			} while (0)
+
+			for (uint32_t i = 0; i < 16; i += 4) {
+				HASHPP_MD5_STEP(0xCA, a, b, c, d, i, 7, i);
+				HASHPP_MD5_STEP(0xCA, d, a, b, c, i + 1, 12, i + 1);
+				HASHPP_MD5_STEP(0xCA, c, d, a, b, i + 2, 17, i + 2);
+				HASHPP_MD5_STEP(0xCA, b, c, d, a, i + 3, 22, i + 3);
+			}
+			for (uint32_t i = 16; i < 32; i += 4) {
+				HASHPP_MD5_GSTEP(a, b, c, d, (5 * i + 1) & 15, 5, i);
+				HASHPP_MD5_GSTEP(d, a, b, c, (5 * i + 6) & 15, 9, i + 1);
+				HASHPP_MD5_GSTEP(c, d, a, b, (5 * i + 11) & 15, 14, i + 2);
+				HASHPP_MD5_GSTEP(b, c, d, a, (5 * i) & 15, 20, i + 3);
+			}
+			for (uint32_t i = 32; i < 48; i += 4) {
+				HASHPP_MD5_STEP(0x96, a, b, c, d, (3 * i + 5) & 15, 4, i);
+				HASHPP_MD5_STEP(0x96, d, a, b, c, (3 * i + 8) & 15, 11, i + 1);
+				HASHPP_MD5_STEP(0x96, c, d, a, b, (3 * i + 11) & 15, 16, i + 2);
+				HASHPP_MD5_STEP(0x96, b, c, d, a, (3 * i + 14) & 15, 23, i + 3);
+			}
+			for (uint32_t i = 48; i < 64; i += 4) {
+				HASHPP_MD5_STEP(0x39, a, b, c, d, (7 * i) & 15, 6, i);
+				HASHPP_MD5_STEP(0x39, d, a, b, c, (7 * i + 7) & 15, 10, i + 1);
+				HASHPP_MD5_STEP(0x39, c, d, a, b, (7 * i + 14) & 15, 15, i + 2);
+				HASHPP_MD5_STEP(0x39, b, c, d, a, (7 * i + 21) & 15, 21, i + 3);
+			}
+
+#undef HASHPP_MD5_GSTEP
+#undef HASHPP_MD5_STEP
+
+			_mm512_store_si512(state, _mm512_add_epi32(A, a));
+			_mm512_store_si512(state + 16, _mm512_add_epi32(B, b));
+			_mm512_store_si512(state + 32, _mm512_add_epi32(C, c));
+			_mm512_store_si512(state + 48, _mm512_add_epi32(D, d));
+		}
+
+		// SHA-1 compression of one 64-byte block from each of sixteen independent
+		// messages, one message per 32-bit AVX-512 lane, using vprold rotates and
+		// vpternlogd for the round functions and the schedule's four-way XOR
+		HASHPP_TARGET("avx512f,avx512bw")
+		inline void sha1_x16_avx512(uint32_t* state, const uint8_t* const* blocks) {
+			const __m512i SWAP = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+			__m512i W[16], S[5];
+
+			for (uint32_t l = 0; l < 16; ++l) {
+				W[l] = _mm512_loadu_si512(blocks[l]);
+			}
+			transpose16x32(W);
+			for (uint32_t i = 0; i < 16; ++i) {
+				W[i] = _mm512_shuffle_epi8(W[i], SWAP);
+			}
+
+			for (uint32_t i = 0; i < 5; ++i) {
+				S[i] = _mm512_load_si512(state + i * 16);
+			}
+
+#define HASHPP_SHA1_W(i) ((i) < 16 ? W[i] : (W[(i) & 15] = _mm512_rol_epi32(_mm512_xor_si512(								\
+				_mm512_ternarylogic_epi32(W[((i) - 3) & 15], W[((i) - 8) & 15], W[((i) - 14) & 15], 0x96), W[(i) & 15]), 1)))
+#define HASHPP_SHA1_STEP(imm, k, i) do {																\
+				const __m512i t = _mm512_add_epi32(_mm512_add_epi32(_mm512_rol_epi32(a, 5), _mm512_ternarylogic_epi32(b, c, d, (imm))),	\
+					_mm512_add_epi32(_mm512_add_epi32(e, (k)), HASHPP_SHA1_W(i)));										\
+				e = d; d = c; c = _mm512_rol_epi32(b, 30); b = a; a = t;												\
+			} while (0)
+
+			// 0xCA => b ? c : d (Ch), 0x96 => three-way XOR (Parity), 0xE8 => majority (Maj)
+			__m512i a = S[0], b = S[1], c = S[2], d = S[3], e = S[4];
+			const __m512i K0 = _mm512_set1_epi32(0x5a827999), K1 = _mm512_set1_epi32(0x6ed9eba1);
+			const __m512i K2 = _mm512_set1_epi32(static_cast<int>(0x8f1bbcdc)), K3 = _mm512_set1_epi32(static_cast<int>(0xca62c1d6));
+			for (uint32_t i = 0; i < 20; ++i) {
+				HASHPP_SHA1_STEP(0xCA, K0, i);
+			}
+			for (uint32_t i = 20; i < 40; ++i) {
+				HASHPP_SHA1_STEP(0x96, K1, i);
+			}
+			for (uint32_t i = 40; i < 60; ++i) {
+				HASHPP_SHA1_STEP(0xE8, K2, i);
+			}
+			for (uint32_t i = 60; i < 80; ++i) {
+				HASHPP_SHA1_STEP(0x96, K3, i);
+			}
+
+#undef HASHPP_SHA1_STEP
+#undef HASHPP_SHA1_W
+
+			S[0] = _mm512_add_epi32(S[0], a); S[1] = _mm512_add_epi32(S[1], b); S[2] = _mm512_add_epi32(S[2], c);
+			S[3] = _mm512_add_epi32(S[3], d); S[4] = _mm512_add_epi32(S[4], e);
+			for (uint32_t i = 0; i < 5; ++i) {
+				_mm512_store_si512(state + i * 16, S[i]);
+			}
+		}
+
+		// MD2 compression of one 16-byte block from each of sixty-four independent
+		// messages, one message per byte lane (byte-sliced, see md2_multibuffer);
+		// each 256-entry S-table lookup is a pair of vpermi2b over its two halves
+		HASHPP_TARGET("avx512f,avx512bw,avx512vbmi")
+		inline void md2_x64_avx512vbmi(uint8_t* x, uint8_t* c, const uint8_t* in) {
+			const __m512i T0 = _mm512_load_si512(MD2_S), T1 = _mm512_load_si512(MD2_S + 64);
+			const __m512i T2 = _mm512_load_si512(MD2_S + 128), T3 = _mm512_load_si512(MD2_S + 192);
+			__m512i X[48], M[16], t = _mm512_setzero_si512();
+
+#define HASHPP_MD2_S(i) _mm512_mask_blend_epi8(_mm512_movepi8_mask(i),			\
+				_mm512_permutex2var_epi8(T0, (i), T1), _mm512_permutex2var_epi8(T2, (i), T3))
+
+			for (uint32_t j = 0; j < 16; ++j) {
+				M[j] = _mm512_load_si512(in + j * 64);
+				X[j] = _mm512_load_si512(x + j * 64);
+				X[j + 16] = M[j];
+				X[j + 32] = _mm512_xor_si512(M[j], X[j]);
+			}
+
+			for (uint32_t j = 0; j < 18; ++j) {
+				for (uint32_t k = 0; k < 48; ++k) {
+					t = X[k] = _mm512_xor_si512(X[k], HASHPP_MD2_S(t));
+				}
+				t = _mm512_add_epi8(t, _mm512_set1_epi8(static_cast<char>(j)));
+			}
+
+			for (uint32_t j = 0; j < 48; ++j) {
+				_mm512_store_si512(x + j * 64, X[j]);
+			}
+
+			t = _mm512_load_si512(c + 15 * 64);
+			for (uint32_t j = 0; j < 16; ++j) {
+				t = _mm512_xor_si512(_mm512_load_si512(c + j * 64), HASHPP_MD2_S(_mm512_xor_si512(M[j], t)));
+				_mm512_store_si512(c + j * 64, t);
+			}
+
+#undef HASHPP_MD2_S
+		}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// one Keccak-f[1600] round as in HASHPP_KECCAK_ROUND, on vectors holding the same lane of
+// several independent states; HASHPP_VCHI(x, y, z) computes x ^ (~y & z), which andnot or
+// a ternary logic instruction makes a single step, so no lanes are held complemented
+#define HASHPP_KECCAK_VROUND(A, E, rc) do {									\
+	Ca = HASHPP_VXOR5(A##ba, A##ga, A##ka, A##ma, A##sa);							\
+	Ce = HASHPP_VXOR5(A##be, A##ge, A##ke, A##me, A##se);							\
+	Ci = HASHPP_VXOR5(A##bi, A##gi, A##ki, A##mi, A##si);							\
+	Co = HASHPP_VXOR5(A##bo, A##go, A##ko, A##mo, A##so);							\
+	Cu = HASHPP_VXOR5(A##bu, A##gu, A##ku, A##mu, A##su);							\
+	Da = HASHPP_VXOR(Cu, HASHPP_VROL(Ce, 1)); De = HASHPP_VXOR(Ca, HASHPP_VROL(Ci, 1));			\
+	Di = HASHPP_VXOR(Ce, HASHPP_VROL(Co, 1)); Do = HASHPP_VXOR(Ci, HASHPP_VROL(Cu, 1));			\
+	Du = HASHPP_VXOR(Co, HASHPP_VROL(Ca, 1));								\
+	Bba = HASHPP_VXOR(A##ba, Da); Bbe = HASHPP_VROL(HASHPP_VXOR(A##ge, De), 44);				\
+	Bbi = HASHPP_VROL(HASHPP_VXOR(A##ki, Di), 43); Bbo = HASHPP_VROL(HASHPP_VXOR(A##mo, Do), 21);		\
+	Bbu = HASHPP_VROL(HASHPP_VXOR(A##su, Du), 14);								\
+	E##ba = HASHPP_VXOR(HASHPP_VCHI(Bba, Bbe, Bbi), (rc));							\
+	E##be = HASHPP_VCHI(Bbe, Bbi, Bbo); E##bi = HASHPP_VCHI(Bbi, Bbo, Bbu);					\
+	E##bo = HASHPP_VCHI(Bbo, Bbu, Bba); E##bu = HASHPP_VCHI(Bbu, Bba, Bbe);					\
+	Bga = HASHPP_VROL(HASHPP_VXOR(A##bo, Do), 28); Bge = HASHPP_VROL(HASHPP_VXOR(A##gu, Du), 20);		\
+	Bgi = HASHPP_VROL(HASHPP_VXOR(A##ka, Da), 3); Bgo = HASHPP_VROL(HASHPP_VXOR(A##me, De), 45);		\
+	Bgu = HASHPP_VROL(HASHPP_VXOR(A##si, Di), 61);								\
+	E##ga = HASHPP_VCHI(Bga, Bge, Bgi); E##ge = HASHPP_VCHI(Bge, Bgi, Bgo);					\
+	E##gi = HASHPP_VCHI(Bgi, Bgo, Bgu); E##go = HASHPP_VCHI(Bgo, Bgu, Bga);					\
+	E##gu = HASHPP_VCHI(Bgu, Bga, Bge);									\
+	Bka = HASHPP_VROL(HASHPP_VXOR(A##be, De), 1); Bke = HASHPP_VROL(HASHPP_VXOR(A##gi, Di), 6);		\
+	Bki = HASHPP_VROL(HASHPP_VXOR(A##ko, Do), 25); Bko = HASHPP_VROL(HASHPP_VXOR(A##mu, Du), 8);		\
+	Bku = HASHPP_VROL(HASHPP_VXOR(A##sa, Da), 18);								\
+	E##ka = HASHPP_VCHI(Bka, Bke, Bki); E##ke = HASHPP_VCHI(Bke, Bki, Bko);					\
+	E##ki = HASHPP_VCHI(Bki, Bko, Bku); E##ko = HASHPP_VCHI(Bko, Bku, Bka);					\
+	E##ku = HASHPP_VCHI(Bku, Bka, Bke);									\
+	Bma = HASHPP_VROL(HASHPP_VXOR(A##bu, Du), 27); Bme = HASHPP_VROL(HASHPP_VXOR(A##ga, Da), 36);		\
+	Bmi = HASHPP_VROL(HASHPP_VXOR(A##ke, De), 10); Bmo = HASHPP_VROL(HASHPP_VXOR(A##mi, Di), 15);		\
+	Bmu = HASHPP_VROL(HASHPP_VXOR(A##so, Do), 56);								\
+	E##ma = HASHPP_VCHI(Bma, Bme, Bmi); E##me = HASHPP_VCHI(Bme, Bmi, Bmo);					\
+	E##mi = HASHPP_VCHI(Bmi, Bmo, Bmu); E##mo = HASHPP_VCHI(Bmo, Bmu, Bma);					\
+	E##mu = HASHPP_VCHI(Bmu, Bma, Bme);									\
+	Bsa = HASHPP_VROL(HASHPP_VXOR(A##bi, Di), 62); Bse = HASHPP_VROL(HASHPP_VXOR(A##go, Do), 55);		\
+	Bsi = HASHPP_VROL(HASHPP_VXOR(A##ku, Du), 39); Bso = HASHPP_VROL(HASHPP_VXOR(A##ma, Da), 41);		\
+	Bsu = HASHPP_VROL(HASHPP_VXOR(A##se, De), 2);								\
+	E##sa = HASHPP_VCHI(Bsa, Bse, Bsi); E##se = HASHPP_VCHI(Bse, Bsi, Bso);					\
+	E##si = HASHPP_VCHI(Bsi, Bso, Bsu); E##so = HASHPP_VCHI(Bso, Bsu, Bsa);					\
+	E##su = HASHPP_VCHI(Bsu, Bsa, Bse);									\
+} while(0)
+
+// permutes the word-major Keccak states at 'state' held in vectors of type V, loading and
+// storing vector i of the state (lane i of every state) with HASHPP_VLOAD and HASHPP_VSTORE
+#define HASHPP_KECCAK_VPERMUTE(V) do {												\
+	V Aba = HASHPP_VLOAD(0), Abe = HASHPP_VLOAD(1), Abi = HASHPP_VLOAD(2), Abo = HASHPP_VLOAD(3),				\
+		Abu = HASHPP_VLOAD(4), Aga = HASHPP_VLOAD(5), Age = HASHPP_VLOAD(6), Agi = HASHPP_VLOAD(7),			\
+		Ago = HASHPP_VLOAD(8), Agu = HASHPP_VLOAD(9), Aka = HASHPP_VLOAD(10), Ake = HASHPP_VLOAD(11),			\
+		Aki = HASHPP_VLOAD(12), Ako = HASHPP_VLOAD(13), Aku = HASHPP_VLOAD(14), Ama = HASHPP_VLOAD(15),			\
+		Ame = HASHPP_VLOAD(16), Ami = HASHPP_VLOAD(17), Amo = HASHPP_VLOAD(18), Amu = HASHPP_VLOAD(19),			\
+		Asa = HASHPP_VLOAD(20), Ase = HASHPP_VLOAD(21), Asi = HASHPP_VLOAD(22), Aso = HASHPP_VLOAD(23),			\
+		Asu = HASHPP_VLOAD(24);												\
+	V Eba, Ebe, Ebi, Ebo, Ebu, Ega, Ege, Egi, Ego, Egu, Eka, Eke, Eki, Eko, Eku;						\
+	V Ema, Eme, Emi, Emo, Emu, Esa, Ese, Esi, Eso, Esu;									\
+	V Bba, Bbe, Bbi, Bbo, Bbu, Bga, Bge, Bgi, Bgo, Bgu, Bka, Bke, Bki, Bko, Bku;						\
+	V Bma, Bme, Bmi, Bmo, Bmu, Bsa, Bse, Bsi, Bso, Bsu;									\
+	V Ca, Ce, Ci, Co, Cu, Da, De, Di, Do, Du;										\
+																\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[0])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[1]));		\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[2])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[3]));		\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[4])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[5]));		\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[6])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[7]));		\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[8])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[9]));		\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[10])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[11]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[12])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[13]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[14])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[15]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[16])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[17]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[18])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[19]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[20])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[21]));	\
+	HASHPP_KECCAK_VROUND(A, E, HASHPP_VSET1(KECCAK_RC[22])); HASHPP_KECCAK_VROUND(E, A, HASHPP_VSET1(KECCAK_RC[23]));	\
+																\
+	HASHPP_VSTORE(0, Aba); HASHPP_VSTORE(1, Abe); HASHPP_VSTORE(2, Abi); HASHPP_VSTORE(3, Abo); HASHPP_VSTORE(4, Abu);	\
+	HASHPP_VSTORE(5, Aga); HASHPP_VSTORE(6, Age); HASHPP_VSTORE(7, Agi); HASHPP_VSTORE(8, Ago); HASHPP_VSTORE(9, Agu);	\
+	HASHPP_VSTORE(10, Aka); HASHPP_VSTORE(11, Ake); HASHPP_VSTORE(12, Aki); HASHPP_VSTORE(13, Ako); HASHPP_VSTORE(14, Aku);	\
+	HASHPP_VSTORE(15, Ama); HASHPP_VSTORE(16, Ame); HASHPP_VSTORE(17, Ami); HASHPP_VSTORE(18, Amo); HASHPP_VSTORE(19, Amu);	\
+	HASHPP_VSTORE(20, Asa); HASHPP_VSTORE(21, Ase); HASHPP_VSTORE(22, Asi); HASHPP_VSTORE(23, Aso); HASHPP_VSTORE(24, Asu);	\
+} while(0)
+
+		// loads words 'w' to w + 3 of blocks[0] to blocks[3] transposed into 't', so that
+		// t[i] holds word w + i of the four blocks
+		HASHPP_TARGET("avx2")
+		inline void keccak_transpose4x64(__m256i t[4], const uint8_t* const* blocks, size_t w) {
+			const __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[0] + w * 8));
+			const __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[1] + w * 8));
+			const __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[2] + w * 8));
+			const __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[3] + w * 8));
+			const __m256i t0 = _mm256_unpacklo_epi64(r0, r1), t1 = _mm256_unpackhi_epi64(r0, r1);
+			const __m256i t2 = _mm256_unpacklo_epi64(r2, r3), t3 = _mm256_unpackhi_epi64(r2, r3);
+			t[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+			t[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+			t[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+			t[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+		}
+
+		// Keccak-f[1600] absorb of one block of 'rate' bytes from each of four independent
+		// messages, one message per 64-bit AVX2 lane (word-major state, see keccak_multibuffer)
+		HASHPP_TARGET("avx2")
+		inline void keccak_x4_avx2(uint64_t* state, const uint8_t* const* blocks, size_t rate) {
+			__m256i* S = reinterpret_cast<__m256i*>(state);
+			const size_t words = rate / 8;
+			size_t w = 0;
+
+			// four words at a time, then the rest of a rate that is not a multiple of 32 bytes
+			for (; w + 4 <= words; w += 4) {
+				__m256i t[4];
+				keccak_transpose4x64(t, blocks, w);
+				for (size_t i = 0; i < 4; ++i) {
+					_mm256_store_si256(S + w + i, _mm256_xor_si256(_mm256_load_si256(S + w + i), t[i]));
+				}
+			}
+			for (; w < words; ++w) {
+				const __m256i t = _mm256_set_epi64x(
+					static_cast<long long>(keccak_lane(blocks[3] + w * 8)), static_cast<long long>(keccak_lane(blocks[2] + w * 8)),
+					static_cast<long long>(keccak_lane(blocks[1] + w * 8)), static_cast<long long>(keccak_lane(blocks[0] + w * 8)));
+				_mm256_store_si256(S + w, _mm256_xor_si256(_mm256_load_si256(S + w), t));
+			}
+
+#define HASHPP_VLOAD(i) _mm256_load_si256(S + (i))
+#define HASHPP_VSTORE(i, x) _mm256_store_si256(S + (i), (x))
+#define HASHPP_VSET1(x) _mm256_set1_epi64x(static_cast<long long>(x))
+#define HASHPP_VXOR(x, y) _mm256_xor_si256((x), (y))
+#define HASHPP_VXOR5(a, b, c, d, e) _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256((a), (b)), _mm256_xor_si256((c), (d))), (e))
+#define HASHPP_VROL(x, n) _mm256_or_si256(_mm256_slli_epi64((x), (n)), _mm256_srli_epi64((x), 64 - (n)))
+#define HASHPP_VCHI(x, y, z) _mm256_xor_si256((x), _mm256_andnot_si256((y), (z)))
+
+			HASHPP_KECCAK_VPERMUTE(__m256i);
+
+#undef HASHPP_VCHI
+#undef HASHPP_VROL
+#undef HASHPP_VXOR5
+#undef HASHPP_VXOR
+#undef HASHPP_VSET1
+#undef HASHPP_VSTORE
+#undef HASHPP_VLOAD
+		}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+		// the same for eight messages, one per 64-bit AVX-512 lane, using vprolq rotates and
+		// vpternlogq for theta's five-way XORs and for chi
+		HASHPP_TARGET("avx512f")
+		inline void keccak_x8_avx512(uint64_t* state, const uint8_t* const* blocks, size_t rate) {
+			const size_t words = rate / 8;
+			size_t w = 0;
+
+			// four words at a time through two 4x4 transposes, one per half of the lanes
+			for (; w + 4 <= words; w += 4) {
+				__m256i lo[4], hi[4];
+				keccak_transpose4x64(lo, blocks, w);
+				keccak_transpose4x64(hi, blocks + 4, w);
+				for (size_t i = 0; i < 4; ++i) {
+					const __m512i t = _mm512_inserti64x4(_mm512_castsi256_si512(lo[i]), hi[i], 1);
+					_mm512_store_si512(state + (w + i) * 8, _mm512_xor_si512(_mm512_load_si512(state + (w + i) * 8), t));
+				}
+			}
+			for (; w < words; ++w) {
+				const __m512i t = _mm512_set_epi64(
+					static_cast<long long>(keccak_lane(blocks[7] + w * 8)), static_cast<long long>(keccak_lane(blocks[6] + w * 8)),
+					static_cast<long long>(keccak_lane(blocks[5] + w * 8)), static_cast<long long>(keccak_lane(blocks[4] + w * 8)),
+					static_cast<long long>(keccak_lane(blocks[3] + w * 8)), static_cast<long long>(keccak_lane(blocks[2] + w * 8)),
+					static_cast<long long>(keccak_lane(blocks[1] + w * 8)), static_cast<long long>(keccak_lane(blocks[0] + w * 8)));
+				_mm512_store_si512(state + w * 8, _mm512_xor_si512(_mm512_load_si512(state + w * 8), t));
+			}
+
+			// 0x96 => three-way XOR, 0xD2 => x ^ (~y & z)
+#define HASHPP_VLOAD(i) _mm512_load_si512(state + (i) * 8)
+#define HASHPP_VSTORE(i, x) _mm512_store_si512(state + (i) * 8, (x))
+#define HASHPP_VSET1(x) _mm512_set1_epi64(static_cast<long long>(x))
+#define HASHPP_VXOR(x, y) _mm512_xor_si512((x), (y))
+#define HASHPP_VXOR5(a, b, c, d, e) _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64((a), (b), (c), 0x96), (d), (e), 0x96)
+#define HASHPP_VROL(x, n) _mm512_rol_epi64((x), (n))
+#define HASHPP_VCHI(x, y, z) _mm512_ternarylogic_epi64((x), (y), (z), 0xD2)
+
+			HASHPP_KECCAK_VPERMUTE(__m512i);
+
+#undef HASHPP_VCHI
+#undef HASHPP_VROL
+#undef HASHPP_VXOR5
+#undef HASHPP_VXOR
+#undef HASHPP_VSET1
+#undef HASHPP_VSTORE
+#undef HASHPP_VLOAD
+		}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#undef HASHPP_KECCAK_VPERMUTE
+#undef HASHPP_KECCAK_VROUND
+
+// BLAKE2 compression with the four rows of the working vector (v[0..3], v[4..7], v[8..11]
+// and v[12..15]) in the vectors a, b, c and d, so that each half round runs its four G
+// functions at once: the columns first, then the diagonals, after rotating rows b, c and d
+// by one, two and three words; the rotates are HASHPP_ROR1 to HASHPP_ROR4 in the order G
+// applies them
+#define HASHPP_BLAKE2_ROWS_G(add, xor_, x, y) do {								\
+	a = add(add(a, b), (x)); d = HASHPP_ROR1(xor_(d, a));							\
+	c = add(c, d); b = HASHPP_ROR2(xor_(b, c));								\
+	a = add(add(a, b), (y)); d = HASHPP_ROR3(xor_(d, a));							\
+	c = add(c, d); b = HASHPP_ROR4(xor_(b, c));								\
+} while(0)
+
+// BLAKE2s with each row in an SSE register
+#define HASHPP_BLAKE2S_ROWS() do {										\
+	__m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h));					\
+	__m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 4));					\
+	const __m128i iv0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA256_H));			\
+	const __m128i iv1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA256_H + 4));			\
+														\
+	for (; blocks != 0; --blocks, data += 64) {								\
+		int m[16];											\
+		memcpy(m, data, 64);										\
+		counter += 64;											\
+														\
+		const __m128i t = _mm_set_epi32(0, (last && blocks == 1) ? -1 : 0,				\
+			static_cast<int>(counter >> 32), static_cast<int>(counter));				\
+		__m128i a = h0, b = h1, c = iv0, d = _mm_xor_si128(iv1, t);					\
+		for (size_t r = 0; r < 10; ++r) {								\
+			const uint8_t* s = BLAKE2_SIGMA[r];							\
+			__m128i x = _mm_set_epi32(m[s[6]], m[s[4]], m[s[2]], m[s[0]]);				\
+			__m128i y = _mm_set_epi32(m[s[7]], m[s[5]], m[s[3]], m[s[1]]);				\
+			HASHPP_BLAKE2_ROWS_G(_mm_add_epi32, _mm_xor_si128, x, y);				\
+			b = _mm_shuffle_epi32(b, 0x39); c = _mm_shuffle_epi32(c, 0x4E);				\
+			d = _mm_shuffle_epi32(d, 0x93);								\
+			x = _mm_set_epi32(m[s[14]], m[s[12]], m[s[10]], m[s[8]]);				\
+			y = _mm_set_epi32(m[s[15]], m[s[13]], m[s[11]], m[s[9]]);				\
+			HASHPP_BLAKE2_ROWS_G(_mm_add_epi32, _mm_xor_si128, x, y);				\
+			b = _mm_shuffle_epi32(b, 0x93); c = _mm_shuffle_epi32(c, 0x4E);				\
+			d = _mm_shuffle_epi32(d, 0x39);								\
+		}												\
+		h0 = _mm_xor_si128(h0, _mm_xor_si128(a, c));							\
+		h1 = _mm_xor_si128(h1, _mm_xor_si128(b, d));							\
+	}													\
+														\
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(h), h0);							\
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(h + 4), h1);						\
+} while(0)
+
+// BLAKE2b with each row in an AVX2 register
+#define HASHPP_BLAKE2B_ROWS() do {										\
+	__m256i h0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h));					\
+	__m256i h1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + 4));				\
+	const __m256i iv0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SHA512_H));			\
+	const __m256i iv1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SHA512_H + 4));			\
+														\
+	for (; blocks != 0; --blocks, data += 128) {								\
+		long long m[16];										\
+		memcpy(m, data, 128);										\
+		counter += 128;											\
+														\
+		const __m256i t = _mm256_set_epi64x(0, (last && blocks == 1) ? -1 : 0,				\
+			0, static_cast<long long>(counter));							\
+		__m256i a = h0, b = h1, c = iv0, d = _mm256_xor_si256(iv1, t);					\
+		for (size_t r = 0; r < 12; ++r) {								\
+			const uint8_t* s = BLAKE2_SIGMA[r];							\
+			__m256i x = _mm256_set_epi64x(m[s[6]], m[s[4]], m[s[2]], m[s[0]]);			\
+			__m256i y = _mm256_set_epi64x(m[s[7]], m[s[5]], m[s[3]], m[s[1]]);			\
+			HASHPP_BLAKE2_ROWS_G(_mm256_add_epi64, _mm256_xor_si256, x, y);				\
+			b = _mm256_permute4x64_epi64(b, 0x39); c = _mm256_permute4x64_epi64(c, 0x4E);		\
+			d = _mm256_permute4x64_epi64(d, 0x93);							\
+			x = _mm256_set_epi64x(m[s[14]], m[s[12]], m[s[10]], m[s[8]]);				\
+			y = _mm256_set_epi64x(m[s[15]], m[s[13]], m[s[11]], m[s[9]]);				\
+			HASHPP_BLAKE2_ROWS_G(_mm256_add_epi64, _mm256_xor_si256, x, y);				\
+			b = _mm256_permute4x64_epi64(b, 0x93); c = _mm256_permute4x64_epi64(c, 0x4E);		\
+			d = _mm256_permute4x64_epi64(d, 0x39);							\
+		}												\
+		h0 = _mm256_xor_si256(h0, _mm256_xor_si256(a, c));						\
+		h1 = _mm256_xor_si256(h1, _mm256_xor_si256(b, d));						\
+	}													\
+														\
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(h), h0);							\
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(h + 4), h1);						\
+} while(0)
+
+		// BLAKE2s compression of 'blocks' blocks (see blake2_generic) with the rows of the
+		// working vector in SSE registers, rotating by 16 and 8 with pshufb
+		HASHPP_TARGET("sse4.1")
+		inline void blake2s_sse41(uint32_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+			const __m128i R16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+			const __m128i R8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+#define HASHPP_ROR1(x) _mm_shuffle_epi8((x), R16)
+#define HASHPP_ROR2(x) _mm_or_si128(_mm_srli_epi32((x), 12), _mm_slli_epi32((x), 20))
+#define HASHPP_ROR3(x) _mm_shuffle_epi8((x), R8)
+#define HASHPP_ROR4(x) _mm_or_si128(_mm_srli_epi32((x), 7), _mm_slli_epi32((x), 25))
+			HASHPP_BLAKE2S_ROWS();
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+		}
+
+		// BLAKE2b compression of 'blocks' blocks (see blake2_generic) with each row of the
+		// working vector split across a pair of SSE registers (the low and high halves l and
+		// h), the diagonal step's row rotations being palignr pairs
+		HASHPP_TARGET("sse4.1")
+		inline void blake2b_sse41(uint64_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+			const __m128i R24 = _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+			const __m128i R16 = _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+			__m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h)), h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 2));
+			__m128i h2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 4)), h3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + 6));
+
+#define HASHPP_ROR1(x) _mm_shuffle_epi32((x), 0xB1)
+#define HASHPP_ROR2(x) _mm_shuffle_epi8((x), R24)
+#define HASHPP_ROR3(x) _mm_shuffle_epi8((x), R16)
+#define HASHPP_ROR4(x) _mm_xor_si128(_mm_srli_epi64((x), 63), _mm_add_epi64((x), (x)))
+#define HASHPP_BLAKE2B_G(a, b, c, d, x, y) do {									\
+				a = _mm_add_epi64(_mm_add_epi64(a, b), (x));					\
+				d = HASHPP_ROR1(_mm_xor_si128(d, a));						\
+				c = _mm_add_epi64(c, d); b = HASHPP_ROR2(_mm_xor_si128(b, c));			\
+				a = _mm_add_epi64(_mm_add_epi64(a, b), (y));					\
+				d = HASHPP_ROR3(_mm_xor_si128(d, a));						\
+				c = _mm_add_epi64(c, d); b = HASHPP_ROR4(_mm_xor_si128(b, c));			\
+			} while (0)
+
+			for (; blocks != 0; --blocks, data += 128) {
+				long long m[16];
+				memcpy(m, data, 128);
+				counter += 128;
+
+				__m128i al = h0, ah = h1, bl = h2, bh = h3;
+				__m128i cl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA512_H));
+				__m128i ch = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA512_H + 2));
+				__m128i dl = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA512_H + 4)),
+					_mm_set_epi64x(0, static_cast<long long>(counter)));
+				__m128i dh = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(SHA512_H + 6)),
+					_mm_set_epi64x(0, (last && blocks == 1) ? -1 : 0));
+
+				for (size_t r = 0; r < 12; ++r) {
+					const uint8_t* s = BLAKE2_SIGMA[r];
+					__m128i t0, t1;
+					HASHPP_BLAKE2B_G(al, bl, cl, dl, _mm_set_epi64x(m[s[2]], m[s[0]]), _mm_set_epi64x(m[s[3]], m[s[1]]));
+					HASHPP_BLAKE2B_G(ah, bh, ch, dh, _mm_set_epi64x(m[s[6]], m[s[4]]), _mm_set_epi64x(m[s[7]], m[s[5]]));
+
+					// rows b, c and d rotated by one, two and three words
+					t0 = _mm_alignr_epi8(bh, bl, 8); t1 = _mm_alignr_epi8(bl, bh, 8); bl = t0; bh = t1;
+					t0 = cl; cl = ch; ch = t0;
+					t0 = _mm_alignr_epi8(dh, dl, 8); t1 = _mm_alignr_epi8(dl, dh, 8); dl = t1; dh = t0;
+
+					HASHPP_BLAKE2B_G(al, bl, cl, dl, _mm_set_epi64x(m[s[10]], m[s[8]]), _mm_set_epi64x(m[s[11]], m[s[9]]));
+					HASHPP_BLAKE2B_G(ah, bh, ch, dh, _mm_set_epi64x(m[s[14]], m[s[12]]), _mm_set_epi64x(m[s[15]], m[s[13]]));
+
+					t0 = _mm_alignr_epi8(bl, bh, 8); t1 = _mm_alignr_epi8(bh, bl, 8); bl = t0; bh = t1;
+					t0 = cl; cl = ch; ch = t0;
+					t0 = _mm_alignr_epi8(dl, dh, 8); t1 = _mm_alignr_epi8(dh, dl, 8); dl = t1; dh = t0;
+				}
+
+				h0 = _mm_xor_si128(h0, _mm_xor_si128(al, cl)); h1 = _mm_xor_si128(h1, _mm_xor_si128(ah, ch));
+				h2 = _mm_xor_si128(h2, _mm_xor_si128(bl, dl)); h3 = _mm_xor_si128(h3, _mm_xor_si128(bh, dh));
+			}
+
+#undef HASHPP_BLAKE2B_G
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(h), h0); _mm_storeu_si128(reinterpret_cast<__m128i*>(h + 2), h1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(h + 4), h2); _mm_storeu_si128(reinterpret_cast<__m128i*>(h + 6), h3);
+		}
+
+		// BLAKE2b with each row in an AVX2 register, rotating by 32, 24 and 16 with shuffles
+		HASHPP_TARGET("avx2")
+		inline void blake2b_avx2(uint64_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+			const __m256i R24 = _mm256_setr_epi8(
+				3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+				3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+			const __m256i R16 = _mm256_setr_epi8(
+				2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+				2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+#define HASHPP_ROR1(x) _mm256_shuffle_epi32((x), 0xB1)
+#define HASHPP_ROR2(x) _mm256_shuffle_epi8((x), R24)
+#define HASHPP_ROR3(x) _mm256_shuffle_epi8((x), R16)
+#define HASHPP_ROR4(x) _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+			HASHPP_BLAKE2B_ROWS();
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+		}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+		// BLAKE2s as in blake2s_sse41 with AVX-512VL vprord rotates
+		HASHPP_TARGET("avx512f,avx512vl")
+		inline void blake2s_avx512(uint32_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+#define HASHPP_ROR1(x) _mm_ror_epi32((x), 16)
+#define HASHPP_ROR2(x) _mm_ror_epi32((x), 12)
+#define HASHPP_ROR3(x) _mm_ror_epi32((x), 8)
+#define HASHPP_ROR4(x) _mm_ror_epi32((x), 7)
+			HASHPP_BLAKE2S_ROWS();
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+		}
+
+		// BLAKE2b as in blake2b_avx2 with AVX-512VL vprorq rotates
+		HASHPP_TARGET("avx512f,avx512vl")
+		inline void blake2b_avx512(uint64_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+#define HASHPP_ROR1(x) _mm256_ror_epi64((x), 32)
+#define HASHPP_ROR2(x) _mm256_ror_epi64((x), 24)
+#define HASHPP_ROR3(x) _mm256_ror_epi64((x), 16)
+#define HASHPP_ROR4(x) _mm256_ror_epi64((x), 63)
+			HASHPP_BLAKE2B_ROWS();
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+		}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#undef HASHPP_BLAKE2B_ROWS
+#undef HASHPP_BLAKE2S_ROWS
+#undef HASHPP_BLAKE2_ROWS_G
+
+// BLAKE3 round over several inputs at once, v[i] holding word i of the working state of
+// every input and M[i] word i of each one's message block, s being the round's message
+// schedule; the ops HASHPP_VADD and HASHPP_VXOR and the rotates HASHPP_ROR1 to
+// HASHPP_ROR4 (by 16, 12, 8 and 7) are defined per kernel
+#define HASHPP_BLAKE3_VG(a, b, c, d, x, y) do {									\
+	v[a] = HASHPP_VADD(HASHPP_VADD(v[a], v[b]), (x)); v[d] = HASHPP_ROR1(HASHPP_VXOR(v[d], v[a]));		\
+	v[c] = HASHPP_VADD(v[c], v[d]); v[b] = HASHPP_ROR2(HASHPP_VXOR(v[b], v[c]));				\
+	v[a] = HASHPP_VADD(HASHPP_VADD(v[a], v[b]), (y)); v[d] = HASHPP_ROR3(HASHPP_VXOR(v[d], v[a]));		\
+	v[c] = HASHPP_VADD(v[c], v[d]); v[b] = HASHPP_ROR4(HASHPP_VXOR(v[b], v[c]));				\
+} while(0)
+#define HASHPP_BLAKE3_VROUND(s) do {										\
+	HASHPP_BLAKE3_VG(0, 4, 8, 12, M[(s)[0]], M[(s)[1]]);							\
+	HASHPP_BLAKE3_VG(1, 5, 9, 13, M[(s)[2]], M[(s)[3]]);							\
+	HASHPP_BLAKE3_VG(2, 6, 10, 14, M[(s)[4]], M[(s)[5]]);							\
+	HASHPP_BLAKE3_VG(3, 7, 11, 15, M[(s)[6]], M[(s)[7]]);							\
+	HASHPP_BLAKE3_VG(0, 5, 10, 15, M[(s)[8]], M[(s)[9]]);							\
+	HASHPP_BLAKE3_VG(1, 6, 11, 12, M[(s)[10]], M[(s)[11]]);							\
+	HASHPP_BLAKE3_VG(2, 7, 8, 13, M[(s)[12]], M[(s)[13]]);							\
+	HASHPP_BLAKE3_VG(3, 4, 9, 14, M[(s)[14]], M[(s)[15]]);							\
+} while(0)
+// the seven rounds, then the feed-forward into the chaining values h
+#define HASHPP_BLAKE3_VCOMPRESS() do {										\
+	HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[0]); HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[1]);			\
+	HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[2]); HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[3]);			\
+	HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[4]); HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[5]);			\
+	HASHPP_BLAKE3_VROUND(BLAKE3_SCHEDULE[6]);								\
+	for (size_t i = 0; i < 8; ++i) {									\
+		h[i] = HASHPP_VXOR(v[i], v[i + 8]);								\
+	}													\
+} while(0)
+
+		// BLAKE3 chaining values of eight inputs at once, one per 32-bit AVX2 lane (see
+		// blake3_x1_generic), each block transposed so that a vector holds one word of all;
+		// every input streams from its own place in memory, so their blocks two ahead are
+		// prefetched
+		HASHPP_TARGET("avx2")
+		inline void blake3_x8_avx2(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+			bool increment, uint32_t flags, uint32_t start, uint32_t end, uint8_t* out) {
+			const __m256i R16 = _mm256_setr_epi8(
+				2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+				2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+			const __m256i R8 = _mm256_setr_epi8(
+				1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+				1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+			const __m256i SIGN = _mm256_set1_epi32(static_cast<int>(0x80000000));
+
+			// per-input counters, lanes whose low word wrapped carrying into the high word
+			const __m256i base = _mm256_set1_epi32(static_cast<int>(counter));
+			const __m256i lo = _mm256_add_epi32(base, increment ? _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) : _mm256_setzero_si256());
+			const __m256i hi = _mm256_sub_epi32(_mm256_set1_epi32(static_cast<int>(counter >> 32)),
+				_mm256_cmpgt_epi32(_mm256_xor_si256(base, SIGN), _mm256_xor_si256(lo, SIGN)));
+
+			__m256i h[8], M[16], v[16];
+			for (size_t i = 0; i < 8; ++i) {
+				h[i] = _mm256_set1_epi32(static_cast<int>(key[i]));
+			}
+
+#define HASHPP_VADD(x, y) _mm256_add_epi32((x), (y))
+#define HASHPP_VXOR(x, y) _mm256_xor_si256((x), (y))
+#define HASHPP_ROR1(x) _mm256_shuffle_epi8((x), R16)
+#define HASHPP_ROR2(x) _mm256_or_si256(_mm256_srli_epi32((x), 12), _mm256_slli_epi32((x), 20))
+#define HASHPP_ROR3(x) _mm256_shuffle_epi8((x), R8)
+#define HASHPP_ROR4(x) _mm256_or_si256(_mm256_srli_epi32((x), 7), _mm256_slli_epi32((x), 25))
+			for (size_t b = 0; b < blocks; ++b) {
+				for (size_t half = 0; half < 2; ++half) {
+					for (size_t l = 0; l < 8; ++l) {
+						M[half * 8 + l] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inputs[l] + b * 64 + half * 32));
+					}
+					transpose8x32(M + half * 8);
+				}
+				for (size_t l = 0; l < 8; ++l) {
+					_mm_prefetch(reinterpret_cast<const char*>(inputs[l] + b * 64 + 128), _MM_HINT_T0);
+				}
+
+				const uint32_t f = flags | (b == 0 ? start : 0) | (b + 1 == blocks ? end : 0);
+				for (size_t i = 0; i < 8; ++i) {
+					v[i] = h[i];
+				}
+				v[8] = _mm256_set1_epi32(static_cast<int>(SHA256_H[0])); v[9] = _mm256_set1_epi32(static_cast<int>(SHA256_H[1]));
+				v[10] = _mm256_set1_epi32(static_cast<int>(SHA256_H[2])); v[11] = _mm256_set1_epi32(static_cast<int>(SHA256_H[3]));
+				v[12] = lo; v[13] = hi; v[14] = _mm256_set1_epi32(64); v[15] = _mm256_set1_epi32(static_cast<int>(f));
+				HASHPP_BLAKE3_VCOMPRESS();
+			}
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+#undef HASHPP_VXOR
+#undef HASHPP_VADD
+
+			transpose8x32(h);
+			for (size_t l = 0; l < 8; ++l) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + l * 32), h[l]);
+			}
+		}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+		// BLAKE3 chaining values of sixteen inputs at once, one per 32-bit AVX-512 lane (see
+		// blake3_x8_avx2)
+		HASHPP_TARGET("avx512f")
+		inline void blake3_x16_avx512(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+			bool increment, uint32_t flags, uint32_t start, uint32_t end, uint8_t* out) {
+			const __m512i base = _mm512_set1_epi32(static_cast<int>(counter));
+			const __m512i step = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+			const __m512i lo = _mm512_add_epi32(base, increment ? step : _mm512_setzero_si512());
+			const __m512i high = _mm512_set1_epi32(static_cast<int>(counter >> 32));
+			const __m512i hi = _mm512_mask_add_epi32(high, _mm512_cmplt_epu32_mask(lo, base), high, _mm512_set1_epi32(1));
+
+			__m512i h[16], M[16], v[16];
+			for (size_t i = 0; i < 8; ++i) {
+				h[i] = _mm512_set1_epi32(static_cast<int>(key[i]));
+			}
+
+#define HASHPP_VADD(x, y) _mm512_add_epi32((x), (y))
+#define HASHPP_VXOR(x, y) _mm512_xor_si512((x), (y))
+#define HASHPP_ROR1(x) _mm512_ror_epi32((x), 16)
+#define HASHPP_ROR2(x) _mm512_ror_epi32((x), 12)
+#define HASHPP_ROR3(x) _mm512_ror_epi32((x), 8)
+#define HASHPP_ROR4(x) _mm512_ror_epi32((x), 7)
+			for (size_t b = 0; b < blocks; ++b) {
+				for (size_t l = 0; l < 16; ++l) {
+					M[l] = _mm512_loadu_si512(inputs[l] + b * 64);
+					_mm_prefetch(reinterpret_cast<const char*>(inputs[l] + b * 64 + 128), _MM_HINT_T0);
+				}
+				transpose16x32(M);
+
+				const uint32_t f = flags | (b == 0 ? start : 0) | (b + 1 == blocks ? end : 0);
+				for (size_t i = 0; i < 8; ++i) {
+					v[i] = h[i];
+				}
+				v[8] = _mm512_set1_epi32(static_cast<int>(SHA256_H[0])); v[9] = _mm512_set1_epi32(static_cast<int>(SHA256_H[1]));
+				v[10] = _mm512_set1_epi32(static_cast<int>(SHA256_H[2])); v[11] = _mm512_set1_epi32(static_cast<int>(SHA256_H[3]));
+				v[12] = lo; v[13] = hi; v[14] = _mm512_set1_epi32(64); v[15] = _mm512_set1_epi32(static_cast<int>(f));
+				HASHPP_BLAKE3_VCOMPRESS();
+			}
+#undef HASHPP_ROR4
+#undef HASHPP_ROR3
+#undef HASHPP_ROR2
+#undef HASHPP_ROR1
+#undef HASHPP_VXOR
+#undef HASHPP_VADD
+
+			// back to one chaining value per row, in the low half of each
+			for (size_t i = 8; i < 16; ++i) {
+				h[i] = _mm512_setzero_si512();
+			}
+			transpose16x32(h);
+			for (size_t l = 0; l < 16; ++l) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + l * 32), _mm512_castsi512_si256(h[l]));
+			}
+		}
+
+#undef HASHPP_BLAKE3_VCOMPRESS
+#undef HASHPP_BLAKE3_VROUND
+#undef HASHPP_BLAKE3_VG
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+		// a single-stream compression function and the name reported for it by cpu::kernel
+		template <class _Word>
+		struct kernel {
+			void (*transform)(_Word*, const uint8_t*, size_t);
+			const char* name;
+		};
+
+		// a Keccak-f[1600] absorb function, taking blocks of a given rate, and its name
+		struct sponge {
+			void (*absorb)(uint64_t*, const uint8_t*, size_t, size_t);
+			const char* name;
+		};
+
+		// a BLAKE2 compression function, taking the count of bytes compressed before and
+		// whether the last block is final, and its name
+		template <class _Word>
+		struct compressor {
+			void (*compress)(_Word*, const uint8_t*, size_t, uint64_t, bool);
+			const char* name;
+		};
+
+		// a BLAKE3 kernel hashing 'width' inputs at once (see blake3_x1_generic) and its name
+		struct lanes {
+			void (*hash)(const uint8_t* const*, size_t, const uint32_t*, uint64_t, bool, uint32_t, uint32_t, uint32_t, uint8_t*);
+			size_t width;
+			const char* name;
+		};
+
+		// the single-stream compression functions bound for each algorithm family
+		struct kernels {
+			kernel<uint32_t> md5, md4, sha1, sha256;
+			kernel<uint64_t> sha512;
+			sponge keccak;
+			compressor<uint64_t> blake2b;
+			compressor<uint32_t> blake2s;
+			lanes blake3;
+		};
+
+		// selects the fastest single-stream kernels the enabled extensions allow
+		inline kernels resolve() noexcept {
+			kernels k = {
+				{ md5_generic, "generic" }, { md4_generic, "generic" }, { sha1_generic, "generic" },
+				{ sha256_generic, "generic" }, { sha512_generic, "generic" }, { keccak_generic, "generic" },
+				{ blake2b_generic, "generic" }, { blake2s_generic, "generic" }, { blake3_x1_generic, 1, "generic" }
+			};
+#if defined(HASHPP_X86)
+			// SHA-1 via the SHA extensions when available, else the AVX2 or SSSE3 vectorized schedule
+			if (hashpp::cpu::hasSHA()) {
+				k.sha1 = { sha1_ni, "sha-ni" };
+			}
+			else if (hashpp::cpu::hasAVX2() && hashpp::cpu::hasBMI2()) {
+				k.sha1 = { sha1_avx2, "avx2" };
+			}
+			else if (hashpp::cpu::hasSSSE3()) {
+				k.sha1 = { sha1_ssse3, "ssse3" };
+			}
+
+			// SHA-256 via the SHA extensions when available, else the two-block AVX2 kernel
+			if (hashpp::cpu::hasSHA()) {
+				k.sha256 = { sha256_ni, "sha-ni" };
+			}
+			else if (hashpp::cpu::hasAVX2() && hashpp::cpu::hasBMI2()) {
+				k.sha256 = { sha256_avx2, "avx2" };
+			}
+
+			// BLAKE2 with the rows of its working vector in vector registers, AVX-512VL adding
+			// single-instruction rotates
+			if (hashpp::cpu::hasAVX512()) {
+				k.blake2b = { blake2b_avx512, "avx512" };
+				k.blake2s = { blake2s_avx512, "avx512" };
+			}
+			else {
+				if (hashpp::cpu::hasAVX2()) {
+					k.blake2b = { blake2b_avx2, "avx2" };
+				}
+				else if (hashpp::cpu::hasSSE41()) {
+					k.blake2b = { blake2b_sse41, "sse4.1" };
+				}
+
+				if (hashpp::cpu::hasSSE41()) {
+					k.blake2s = { blake2s_sse41, "sse4.1" };
+				}
+			}
+
+			// BLAKE3 hashing a chunk (or parent) per 32-bit lane
+			if (hashpp::cpu::hasAVX512()) {
+				k.blake3 = { blake3_x16_avx512, 16, "avx512" };
+			}
+			else if (hashpp::cpu::hasAVX2()) {
+				k.blake3 = { blake3_x8_avx2, 8, "avx2" };
+			}
+
+			// SHA-512 via the AVX-512 or AVX2 vectorized schedule when available; 32-bit builds
+			// use the SSE2 kernel instead, as the scalar 64-bit rounds of the others would be
+			// split across register pairs
+			if constexpr (sizeof(void*) == 4) {
+				if (hashpp::cpu::hasSSE2()) {
+					k.sha512 = { sha512_sse2, "sse2" };
+				}
+			}
+			else {
+				if (hashpp::cpu::hasAVX512() && hashpp::cpu::hasBMI2()) {
+					k.sha512 = { sha512_avx512, "avx512" };
+				}
+				else if (hashpp::cpu::hasAVX2() && hashpp::cpu::hasBMI2()) {
+					k.sha512 = { sha512_avx2, "avx2" };
+				}
+
+				// Keccak via BMI2 rotates where available (64-bit builds only, as above)
+				if (hashpp::cpu::hasBMI2()) {
+					k.keccak = { keccak_bmi2, "bmi2" };
+				}
+			}
+#endif
+			return k;
+		}
+
+		// the kernels in use, resolved on first use and again by cpu::disable
+		inline kernels& bound() noexcept {
+			static kernels k = resolve();
+			return k;
+		}
+
+		// single-stream MD4 compression
+		inline void md4_blocks(uint32_t state[4], const uint8_t* data, size_t blocks) {
+			bound().md4.transform(state, data, blocks);
+		}
+
+		// single-stream MD5 compression
+		inline void md5_blocks(uint32_t state[4], const uint8_t* data, size_t blocks) {
+			bound().md5.transform(state, data, blocks);
+		}
+
+		// single-stream SHA-1 compression
+		inline void sha1_blocks(uint32_t state[5], const uint8_t* data, size_t blocks) {
+			bound().sha1.transform(state, data, blocks);
+		}
+
+		// single-stream SHA-256 (and SHA2-224) compression
+		inline void sha256_blocks(uint32_t state[8], const uint8_t* data, size_t blocks) {
+			bound().sha256.transform(state, data, blocks);
+		}
+
+		// single-stream SHA-512 (and SHA2-384, SHA2-512/t) compression
+		inline void sha512_blocks(uint64_t state[8], const uint8_t* data, size_t blocks) {
+			bound().sha512.transform(state, data, blocks);
+		}
+
+		// single-stream Keccak-f[1600] absorb of 'blocks' blocks of 'rate' bytes
+		inline void keccak_blocks(uint64_t st[25], const uint8_t* data, size_t blocks, size_t rate) {
+			bound().keccak.absorb(st, data, blocks, rate);
+		}
+
+		// single-stream BLAKE2b compression (see blake2_generic)
+		inline void blake2b_blocks(uint64_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+			bound().blake2b.compress(h, data, blocks, counter, last);
+		}
+
+		// single-stream BLAKE2s compression (see blake2_generic)
+		inline void blake2s_blocks(uint32_t h[8], const uint8_t* data, size_t blocks, uint64_t counter, bool last) {
+			bound().blake2s.compress(h, data, blocks, counter, last);
+		}
+
+		// BLAKE3 chaining values of the 'n' inputs at 'data', 'stride' bytes apart, across the
+		// lanes of the bound kernel (see blake3_x1_generic); a last partial group repeats its
+		// first input in the lanes left over
+		inline void blake3_many(const uint8_t* data, size_t stride, size_t n, size_t blocks, const uint32_t key[8],
+			uint64_t counter, bool increment, uint32_t flags, uint32_t start, uint32_t end, uint8_t* out) {
+			const lanes& k = bound().blake3;
+			const uint8_t* inputs[16];
+
+			for (size_t i = 0; i < n; i += k.width) {
+				const size_t count = n - i < k.width ? n - i : k.width;
+				const uint64_t c = counter + (increment ? i : 0);
+				for (size_t l = 0; l < k.width; ++l) {
+					inputs[l] = data + stride * (l < count ? i + l : i);
+				}
+
+				if (count == k.width) {
+					k.hash(inputs, blocks, key, c, increment, flags, start, end, out + i * 32);
+				}
+				else if (count == 1) {
+					blake3_x1_generic(inputs, blocks, key, c, increment, flags, start, end, out + i * 32);
+				}
+				else {
+					uint8_t cvs[16 * 32];
+					k.hash(inputs, blocks, key, c, increment, flags, start, end, cvs);
+					memcpy(out + i * 32, cvs, count * 32);
+				}
+			}
+		}
+
+		// BLAKE3 chaining value of the subtree over the 'chunks' (a power of two) whole chunks
+		// at 'data', the first being chunk 'counter' of the message; up to 64 chunks are hashed
+		// and then reduced a level at a time in place, larger subtrees are split in half
+		inline void blake3_subtree(const uint8_t* data, size_t chunks, const uint32_t key[8], uint64_t counter,
+			uint32_t flags, uint8_t out[32]) {
+			if (chunks > 64) {
+				uint8_t children[64];
+				blake3_subtree(data, chunks / 2, key, counter, flags, children);
+				blake3_subtree(data + chunks / 2 * 1024, chunks / 2, key, counter + chunks / 2, flags, children + 32);
+				blake3_parent(children, key, flags, false, out);
+				return;
+			}
+
+			uint8_t cvs[64 * 32];
+			blake3_many(data, 1024, chunks, 16, key, counter, true, flags, BLAKE3_CHUNK_START, BLAKE3_CHUNK_END, cvs);
+			for (; chunks > 1; chunks /= 2) {
+				blake3_many(cvs, 64, chunks / 2, 1, key, 0, false, flags | BLAKE3_PARENT, 0, 0, cvs);
+			}
+			memcpy(out, cvs, 32);
+		}
+
+		// runs fn(begin, end) over contiguous ranges splitting [0, n) across the hardware
+		// threads, at least 'grain' items apiece; all on the calling thread when there is
+		// too little work or with HASHPP_DISABLE_THREADS defined, and the ranges of any
+		// threads that fail to start are run there too
+		template <class _Fn>
+		inline void parallel(size_t n, size_t grain, const _Fn& fn) {
+#if !defined(HASHPP_DISABLE_THREADS)
+			size_t threads = std::thread::hardware_concurrency();
+			if (threads > n / grain) {
+				threads = n / grain;
+			}
+
+			if (threads > 1) {
+				// joins the started workers however this returns
+				struct joiner {
+					std::vector<std::thread> workers;
+					~joiner() {
+						for (std::thread& worker : this->workers) {
+							worker.join();
+						}
+					}
+				} pool;
+
+				pool.workers.reserve(threads - 1);
+				size_t started = 1;
+				try {
+					for (; started < threads; ++started) {
+						const size_t t = started;
+						pool.workers.emplace_back([&fn, n, threads, t]() { fn(n * t / threads, n * (t + 1) / threads); });
+					}
+				}
+				catch (const std::system_error&) {}
+
+				fn(0, n / threads);
+				if (started < threads) {
+					fn(n * started / threads, n);
+				}
+				return;
+			}
+#else
+			(void)grain;
+#endif
+			fn(0, n);
+		}
+
+		// SHA-3 digest (or, with the SHAKE suffix 0x1F, the first _Digest bytes of SHAKE output)
+		// of the 'len' bytes at 'data' at rate _Rate, written as hexadecimal to 'hex' with the
+		// state and final block on the stack
+		template <size_t _Rate, uint8_t _Suffix = 0x06, size_t _Digest = 100 - _Rate / 2>
+		inline void sha3(const uint8_t* data, size_t len, char* hex) noexcept {
+			static_assert(_Digest <= _Rate, "the digest must fit in one block of output");
+			const char* digits = "0123456789abcdef";
+			uint64_t st[25] = { 0 };
+			uint8_t block[_Rate] = { 0 };
+
+			keccak_blocks(st, data, len / _Rate, _Rate);
+			memcpy(block, data + (len - len % _Rate), len % _Rate);
+			block[len % _Rate] = _Suffix;
+			block[_Rate - 1] |= 0x80;
+			keccak_blocks(st, block, 1, _Rate);
+
+			keccak_extract(st, block, _Digest);
+			for (size_t i = 0; i < _Digest; ++i) {
+				hex[i * 2] = digits[block[i] >> 4];
+				hex[i * 2 + 1] = digits[block[i] & 0x0F];
+			}
+		}
+
+		// unkeyed BLAKE2b-512 (_Word = uint64_t) or BLAKE2s-256 (uint32_t) digest of the 'len'
+		// bytes at 'data', written as hexadecimal to 'hex' with the state and final block on
+		// the stack
+		template <class _Word>
+		inline void blake2(const uint8_t* data, size_t len, char* hex) noexcept {
+			constexpr size_t block = 16 * sizeof(_Word), digest = 8 * sizeof(_Word);
+			const char* digits = "0123456789abcdef";
+			_Word h[8];
+			uint8_t last[block] = { 0 };
+
+			for (size_t i = 0; i < 8; ++i) {
+				if constexpr (sizeof(_Word) == 8) {
+					h[i] = SHA512_H[i];
+				}
+				else {
+					h[i] = SHA256_H[i];
+				}
+			}
+			h[0] ^= 0x01010000 ^ digest;
+
+			// all but the last (possibly partial) block, then the last flagged as final, its
+			// counter covering only the message bytes it holds
+			const size_t blocks = len == 0 ? 0 : (len - 1) / block;
+			memcpy(last, data + blocks * block, len - blocks * block);
+			if constexpr (sizeof(_Word) == 8) {
+				blake2b_blocks(h, data, blocks, 0, false);
+				blake2b_blocks(h, last, 1, static_cast<uint64_t>(len) - block, true);
+			}
+			else {
+				blake2s_blocks(h, data, blocks, 0, false);
+				blake2s_blocks(h, last, 1, static_cast<uint64_t>(len) - block, true);
+			}
+
+			for (size_t i = 0; i < digest; ++i) {
+				const uint8_t b = static_cast<uint8_t>(h[i / sizeof(_Word)] >> (8 * (i % sizeof(_Word))));
+				hex[i * 2] = digits[b >> 4];
+				hex[i * 2 + 1] = digits[b & 0x0F];
+			}
+		}
+	}
+
+	inline void cpu::disable(const std::string& extensions) {
+		features() = withhold(detected(), extensions.c_str());
+		hashpp::simd::bound() = hashpp::simd::resolve();
+	}
+
+	inline const char* cpu::kernel(hashpp::ALGORITHMS algorithm) noexcept {
+		switch (algorithm) {
+		case hashpp::ALGORITHMS::MD5: return hashpp::simd::bound().md5.name;
+		case hashpp::ALGORITHMS::MD4: return hashpp::simd::bound().md4.name;
+		case hashpp::ALGORITHMS::SHA1: return hashpp::simd::bound().sha1.name;
+		case hashpp::ALGORITHMS::SHA2_224:
+		case hashpp::ALGORITHMS::SHA2_256: return hashpp::simd::bound().sha256.name;
+		case hashpp::ALGORITHMS::SHA2_384:
+		case hashpp::ALGORITHMS::SHA2_512:
+		case hashpp::ALGORITHMS::SHA2_512_224:
+		case hashpp::ALGORITHMS::SHA2_512_256: return hashpp::simd::bound().sha512.name;
+		case hashpp::ALGORITHMS::SHA3_224:
+		case hashpp::ALGORITHMS::SHA3_256:
+		case hashpp::ALGORITHMS::SHA3_384:
+		case hashpp::ALGORITHMS::SHA3_512:
+		case hashpp::ALGORITHMS::SHAKE128:
+		case hashpp::ALGORITHMS::SHAKE256: return hashpp::simd::bound().keccak.name;
+		case hashpp::ALGORITHMS::BLAKE2B: return hashpp::simd::bound().blake2b.name;
+		case hashpp::ALGORITHMS::BLAKE2S: return hashpp::simd::bound().blake2s.name;
+		case hashpp::ALGORITHMS::BLAKE3: return hashpp::simd::bound().blake3.name;
+		default: return "generic";
+		}
+	}
+
+	// Message Digest (MDX) hash family - excluding MD6
+	namespace MD {
+		class MD5 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 16);
+			}
+
+			// private members
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 16;
+
+			typedef struct {
+				uint64_t size;
+				uint32_t buf[4];
+				uint8_t  in[64], digest[16];
+			} CTX;
+
+			// CTX context instance
+			CTX context = { 0 };
+
+			// pad data for when we need to... well.. pad to appropriate size
+			uint8_t pad[64] = {
+				0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+			};
+
+			// MD5 algorithm-defined constants 
+			// as per: https://en.wikipedia.org/wiki/MD5#Pseudocode
+			const uint32_t A = 0x67452301;
+			const uint32_t B = 0xefcdab89;
+			const uint32_t C = 0x98badcfe;
+			const uint32_t D = 0x10325476;
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			// private class methods
+		private:
+			// initialize our context for this hash function
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class MD4 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 16);
+			}
+
+			// private members
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 16;
+
+			typedef struct {
+				uint64_t size;
+				uint32_t buf[4];
+				uint8_t  in[64], digest[16];
+			} CTX;
+
+			// CTX context instance
+			CTX context = { 0 };
+
+			// pad data for when we need to... well.. pad to appropriate size
+			uint8_t pad[64] = {
+				0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+			};
+
+			// algorithm-defined constants
+			const uint32_t A = 0x67452301;
+			const uint32_t B = 0xefcdab89;
+			const uint32_t C = 0x98badcfe;
+			const uint32_t D = 0x10325476;
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			// private class methods
+		private:
+			// initialize our context for this hash function
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class MD2 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 16);
+			}
+
+			// private members
+		private:
+			const uint8_t BLOCK_SIZE = 16, DIGEST_SIZE = 16;
+
+			typedef struct {
+				uint8_t buf[16], state[48], checksum[16], digest[16];
+				uint64_t size;
+			} CTX;
+
+			CTX context = { 0 };
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		// MD5
+		inline void hashpp::MD::MD5::ctx_init() {
+			this->context = {
+				0,
+				{this->A, this->B, this->C, this->D}
+			};
+		}
+		inline void hashpp::MD::MD5::ctx_transform(const uint8_t* data) {
+			hashpp::simd::md5_blocks(this->context.buf, data, 1);
+		}
+		inline void hashpp::MD::MD5::ctx_update(const uint8_t* data, size_t len) {
+			size_t offset = this->context.size % 64;
+			this->context.size += static_cast<uint64_t>(len);
+
+			// complete a buffered partial block first
+			if (offset != 0) {
+				size_t fill = 64 - offset;
+				if (len < fill) {
+					memcpy(this->context.in + offset, data, len);
+					return;
+				}
+				memcpy(this->context.in + offset, data, fill);
+				this->ctx_transform(this->context.in);
+				data += fill;
+				len -= fill;
+			}
+
+			// full blocks are transformed straight from the input
+			if (len >= 64) {
+				hashpp::simd::md5_blocks(this->context.buf, data, len / 64);
+				data += len & ~static_cast<size_t>(63);
+				len &= 63;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.in, data, len);
+			}
+		}
+		inline void hashpp::MD::MD5::ctx_final() {
+			uint32_t offset = this->context.size % 64, plen = offset < 56 ? 56 - offset : (56 + 64) - offset;
+			uint64_t bits = this->context.size * 8;
+
+			this->ctx_update(this->pad, plen);
+
+			// the message length in bits closes the block, little-endian
+			for (uint32_t j = 0; j < 8; ++j) {
+				this->context.in[56 + j] = static_cast<uint8_t>(bits >> (j * 8));
+			}
+			this->ctx_transform(this->context.in);
+
+			for (uint32_t i = 0; i < 4; ++i) {
+				this->context.digest[(i * 4) + 0] = static_cast<uint8_t>((this->context.buf[i] & 0x000000FF));
+				this->context.digest[(i * 4) + 1] = static_cast<uint8_t>((this->context.buf[i] & 0x0000FF00) >> 8);
+				this->context.digest[(i * 4) + 2] = static_cast<uint8_t>((this->context.buf[i] & 0x00FF0000) >> 16);
+				this->context.digest[(i * 4) + 3] = static_cast<uint8_t>((this->context.buf[i] & 0xFF000000) >> 24);
+			}
+		}
+		inline std::string MD5::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string MD5::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[64] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// MD4
+		inline void hashpp::MD::MD4::ctx_init() {
+			this->context = {
+				0,
+				{this->A, this->B, this->C, this->D}
+			};
+		}
+		inline void hashpp::MD::MD4::ctx_transform(const uint8_t* data) {
+			hashpp::simd::md4_blocks(this->context.buf, data, 1);
+		}
+		inline void hashpp::MD::MD4::ctx_update(const uint8_t* data, size_t len) {
+			size_t offset = this->context.size % 64;
+			this->context.size += static_cast<uint64_t>(len);
+
+			// complete a buffered partial block first
+			if (offset != 0) {
+				size_t fill = 64 - offset;
+				if (len < fill) {
+					memcpy(this->context.in + offset, data, len);
+					return;
+				}
+				memcpy(this->context.in + offset, data, fill);
+				this->ctx_transform(this->context.in);
+				data += fill;
+				len -= fill;
+			}
+
+			// full blocks are transformed straight from the input
+			if (len >= 64) {
+				hashpp::simd::md4_blocks(this->context.buf, data, len / 64);
+				data += len & ~static_cast<size_t>(63);
+				len &= 63;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.in, data, len);
+			}
+		}
+		inline void hashpp::MD::MD4::ctx_final() {
+			uint32_t offset = this->context.size % 64, plen = offset < 56 ? 56 - offset : (56 + 64) - offset;
+			uint64_t bits = this->context.size * 8;
+
+			this->ctx_update(this->pad, plen);
+
+			// the message length in bits closes the block, little-endian
+			for (uint32_t j = 0; j < 8; ++j) {
+				this->context.in[56 + j] = static_cast<uint8_t>(bits >> (j * 8));
+			}
+			this->ctx_transform(this->context.in);
+
+			// move to digest as big-endian
+			// as per: https://stackoverflow.com/questions/19275955/convert-little-endian-to-big-endian/19276193
+			for (uint32_t i = 0; i < 4; ++i) {
+				this->context.digest[(i * 4) + 0] = static_cast<uint8_t>((this->context.buf[i] & 0x000000FF));
+				this->context.digest[(i * 4) + 1] = static_cast<uint8_t>((this->context.buf[i] & 0x0000FF00) >> 8);
+				this->context.digest[(i * 4) + 2] = static_cast<uint8_t>((this->context.buf[i] & 0x00FF0000) >> 16);
+				this->context.digest[(i * 4) + 3] = static_cast<uint8_t>((this->context.buf[i] & 0xFF000000) >> 24);
+			}
+		}
+		inline std::string MD4::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string MD4::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[64] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// MD2
+		inline void hashpp::MD::MD2::ctx_init() {
+			memset(this->context.state, 0, 48);
+			memset(this->context.checksum, 0, 16);
+			memset(this->context.buf, 0, 16);
+			memset(this->context.digest, 0, 16);
+			this->context.size = 0;
+		}
+		inline void hashpp::MD::MD2::ctx_transform(const uint8_t* data) {
+			hashpp::simd::md2_generic(this->context.state, this->context.checksum, data, 1);
+		}
+		inline void hashpp::MD::MD2::ctx_update(const uint8_t* data, size_t len) {
+			// top up a partially filled buffer first
+			if (this->context.size != 0) {
+				size_t n = 16 - this->context.size;
+				if (n > len) {
+					n = len;
+				}
+				memcpy(this->context.buf + this->context.size, data, n);
+				this->context.size += n;
+				data += n;
+				len -= n;
+
+				if (this->context.size < 16) {
+					return;
+				}
+				ctx_transform(this->context.buf);
+				this->context.size = 0;
+			}
+
+			// whole blocks are compressed straight from the input
+			if (len >= 16) {
+				hashpp::simd::md2_generic(this->context.state, this->context.checksum, data, len / 16);
+				data += len & ~static_cast<size_t>(15);
+				len &= 15;
+			}
+
+			memcpy(this->context.buf, data, len);
+			this->context.size = len;
+		}
+		inline void hashpp::MD::MD2::ctx_final() {
+			uint32_t pad = 16 - this->context.size;
+			while (this->context.size < 16) {
+				this->context.buf[this->context.size++] = pad;
+			}
+			ctx_transform(this->context.buf);
+			ctx_transform(this->context.checksum);
+			memcpy(this->context.digest, this->context.state, 16);
+		}
+		inline std::string MD2::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string MD2::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[16] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+	}
+
+	// Secure Hash Algorithm (SHA) hash family 
+	namespace SHA {
+		// SHA algorithms, such as SHA2-224, SHA2-384,
+		// SHA2-512-224, and SHA2-512-256 are simply
+		// truncated versions of their accompanying
+		// algorithm.
+		//
+		// for instance, SHA2-512-256 is SHA-512
+		// truncated to a 256-bit digest length.
+		// likewise, SHA2-224 is SHA2-256 truncated
+		// to a 224-bit digest length.
+		//
+		// these truncations are achieved via the 
+		// omission of trailing H-constants from
+		// the digest output, as well as different
+		// H-constant values from the orignal
+		// algorithm.
+
+		class SHA1 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 20);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 20;
+
+			typedef struct {
+				uint32_t state[5], size;
+				uint64_t bitsize;
+				uint8_t  data[64], digest[20];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-1 algorithm
+			// as per: https://datatracker.ietf.org/doc/html/rfc3174
+			const uint32_t H[5] = {
+				0x67452301,
+				0xEFCDAB89,
+				0x98BADCFE,
+				0x10325476,
+				0xc3d2e1f0
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class SHA2_224 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 28);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 28;
+
+			typedef struct {
+				uint32_t state[8];
+				uint64_t size, bitsize;
+				uint8_t  data[64], digest[28];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA2-224 algorithm
+			// as per: https://datatracker.ietf.org/doc/html/rfc3874
+			const uint32_t H[8] = {
+				0xC1059ED8,
+				0x367CD507,
+				0x3070DD17,
+				0xF70E5939,
+				0xFFC00B31,
+				0x68581511,
+				0x64F98FA7,
+				0xBEFA4FA4
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class SHA2_256 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 32);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 32;
+
+			typedef struct {
+				uint32_t state[8], size;
+				uint64_t bitsize;
+				uint8_t  data[64], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-256 algorithm
+			// as per: https://datatracker.ietf.org/doc/html/rfc6234
+			const uint32_t H[8] = {
+				0x6a09e667,
+				0xbb67ae85,
+				0x3c6ef372,
+				0xa54ff53a,
+				0x510e527f,
+				0x9b05688c,
+				0x1f83d9ab,
+				0x5be0cd19
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+
+		};
+		class SHA2_384 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 48);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 48;
+
+			typedef struct {
+				uint64_t state[8], count[2];
+				uint8_t  data[128], digest[48];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-512 algorithm
+			// as per: https://datatracker.ietf.org/doc/html/rfc4634
+			const uint64_t H[8] = {
+				0xCBBB9D5DC1059ED8,
+				0x629A292A367CD507,
+				0x9159015A3070DD17,
+				0x152FECD8F70E5939,
+				0x67332667FFC00B31,
+				0x8EB44A8768581511,
+				0xDB0C2E0D64F98FA7,
+				0x47B5481DBEFA4FA4
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class SHA2_512 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 64);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 64;
+
+			typedef struct {
+				uint64_t state[8], count[2];
+				uint8_t  data[128], digest[64];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-512 algorithm
+			// as per: https://datatracker.ietf.org/doc/html/rfc4634
+			const uint64_t H[8] = {
+				0x6A09E667F3BCC908,
+				0xBB67AE8584CAA73B,
+				0x3C6EF372FE94F82B,
+				0xA54FF53A5F1D36F1,
+				0x510E527FADE682D1,
+				0x9B05688C2B3E6C1F,
+				0x1F83D9ABFB41BD6B,
+				0x5BE0CD19137E2179
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class SHA2_512_224 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 28);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 28;
+
+			typedef struct {
+				uint64_t state[8], count[2];
+				uint8_t  data[128], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-512/224 algorithm
+			// as per: https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHA512_224.pdf
+			const uint64_t H[8] = {
+				0x8C3D37C819544DA2,
+				0x73E1996689DCD4D6,
 				0x1DFAB7AE32FF9C82,
 				0x679DD514582F9FCF,
 				0x0F6D2B697BD44DA8,
@@ -1422,319 +5278,1355 @@ namespace hashpp {
 				0x1112E6AD91D692A1,
 			};
 
-			// more constants (K)... as per above
-			const uint64_t K[80] = {
-				0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
-				0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
-				0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
-				0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
-				0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
-				0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
-				0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
-				0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
-				0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
-				0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
-				0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30,
-				0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
-				0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
-				0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
-				0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
-				0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
-				0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
-				0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
-				0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
-				0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
-			};
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+		class SHA2_512_256 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 32);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 32;
+
+			typedef struct {
+				uint64_t state[8], count[2];
+				uint8_t  data[128], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// constants (H) defined by SHA-512/256 algorithm
+			// as per: https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHA512_256.pdf
+			const uint64_t H[8] = {
+				0x22312194FC2BF72C,
+				0x9F555FA3C84C64C2,
+				0x2393B86B6F53B151,
+				0x963877195940EABD,
+				0x96283EE2A88EFFE3,
+				0xBE5E1E2553863992,
+				0x2B0199FC2C85B8AA,
+				0x0EB72DDC81C52CA2
+			};
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		// SHA3-224, SHA3-256, SHA3-384 and SHA3-512 (FIPS 202) are the Keccak sponge with a
+		// capacity of twice the digest length, so each absorbs 200 - 2 * digest bytes per
+		// permutation of hashpp::simd::keccak_blocks; the rate doubles as the HMAC block size
+		class SHA3_224 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 28);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 144, DIGEST_SIZE = 28;
+
+			// Keccak state and the pending partial block of 'BLOCK_SIZE' (the rate) bytes
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				uint8_t  data[144], digest[28];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		class SHA3_256 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 32);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 136, DIGEST_SIZE = 32;
+
+			// Keccak state and the pending partial block of 'BLOCK_SIZE' (the rate) bytes
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				uint8_t  data[136], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		class SHA3_384 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 48);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 104, DIGEST_SIZE = 48;
+
+			// Keccak state and the pending partial block of 'BLOCK_SIZE' (the rate) bytes
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				uint8_t  data[104], digest[48];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		class SHA3_512 : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 64);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 72, DIGEST_SIZE = 64;
+
+			// Keccak state and the pending partial block of 'BLOCK_SIZE' (the rate) bytes
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				uint8_t  data[72], digest[64];
+			} CTX;
+
+			CTX context = { 0 };
+
+			// the byte 0x36 repeated 'B' times where 'B' => block size
+			std::vector<uint8_t> ipad = {
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
+			};
+
+			// the byte 0x5c repeated 'B' times
+			std::vector<uint8_t> opad = {
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			};
+
+			inline void ctx_init() override;
+			inline void ctx_transform(const uint8_t* data);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		// SHAKE128 and SHAKE256 (FIPS 202) are extendable-output functions on the Keccak sponge:
+		// after absorbing input through update, output of any length is produced by successive
+		// calls to squeeze, straight into the caller's buffers. getHash returns the first 32
+		// (SHAKE128) or 64 (SHAKE256) bytes of output, which give each its full security strength.
+		// as XOFs they have no HMAC construction
+		class SHAKE128 {
+		public:
+			// absorbs 'len' more bytes of input; returns false, absorbing nothing, once
+			// output has been squeezed (until reset)
+			inline bool update(const void* data, size_t len);
+			bool update(const std::string& data) {
+				return this->update(data.data(), data.length());
+			}
+
+			// writes the next 'n' bytes of output to 'out', the first call completing the input
+			inline void squeeze(void* out, size_t n);
+
+			// discards all input and output, for the object to be reused
+			void reset() noexcept {
+				this->context = { {0}, 0, false };
+			}
+
+			// get hexadecimal hash (the first 32 bytes of output) from data
+			inline std::string getHash(const std::string& data);
+
+			// get hexadecimal hash (the first 32 bytes of output) from file
+			inline std::string getHash(const std::filesystem::path& path);
+
+		private:
+			// Keccak state and the pending partial block of input (up to the rate); once
+			// squeezing, 'data' holds the current block of output and 'size' the bytes of it used
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				bool squeezing;
+				uint8_t  data[168];
+			} CTX;
+
+			CTX context = { 0 };
+
+			inline void ctx_final();
+
+			// squeezes the first 32 bytes of output as hexadecimal
+			inline std::string hexDigest();
+		};
+
+		class SHAKE256 {
+		public:
+			// absorbs 'len' more bytes of input; returns false, absorbing nothing, once
+			// output has been squeezed (until reset)
+			inline bool update(const void* data, size_t len);
+			bool update(const std::string& data) {
+				return this->update(data.data(), data.length());
+			}
+
+			// writes the next 'n' bytes of output to 'out', the first call completing the input
+			inline void squeeze(void* out, size_t n);
+
+			// discards all input and output, for the object to be reused
+			void reset() noexcept {
+				this->context = { {0}, 0, false };
+			}
+
+			// get hexadecimal hash (the first 64 bytes of output) from data
+			inline std::string getHash(const std::string& data);
+
+			// get hexadecimal hash (the first 64 bytes of output) from file
+			inline std::string getHash(const std::filesystem::path& path);
+
+		private:
+			// Keccak state and the pending partial block of input (up to the rate); once
+			// squeezing, 'data' holds the current block of output and 'size' the bytes of it used
+			typedef struct {
+				uint64_t state[25];
+				uint32_t size;
+				bool squeezing;
+				uint8_t  data[136];
+			} CTX;
+
+			CTX context = { 0 };
+
+			inline void ctx_final();
+
+			// squeezes the first 64 bytes of output as hexadecimal
+			inline std::string hexDigest();
+		};
+
+		// SHA-1
+		inline void hashpp::SHA::SHA1::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3], this->H[4]},
+				0, 0
+			};
+		}
+		inline void hashpp::SHA::SHA1::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha1_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA1::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 64 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.bitsize += 512;
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
+
+			// full blocks are transformed straight from the input, in one run so
+			// that multi-block kernels see consecutive blocks
+			if (len >= 64) {
+				hashpp::simd::sha1_blocks(this->context.state, data, len / 64);
+				this->context.bitsize += static_cast<uint64_t>(len / 64) * 512;
+				data += len & ~static_cast<size_t>(63);
+				len &= 63;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
+			}
+		}
+		inline void hashpp::SHA::SHA1::ctx_final() {
+			uint32_t L = this->context.size;
+
+			if (this->context.size < 56) {
+				this->context.data[L++] = 0x80;
+				while (L < 56) {
+					this->context.data[L++] = 0x00;
+				}
+			}
+			else {
+				this->context.data[L++] = 0x80;
+				while (L < 64) {
+					this->context.data[L++] = 0x00;
+				}
+				this->ctx_transform(this->context.data);
+				memset(this->context.data, 0, 56);
+			}
+
+			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
+			this->context.data[63] = this->context.bitsize;
+			this->context.data[62] = this->context.bitsize >> 8;
+			this->context.data[61] = this->context.bitsize >> 16;
+			this->context.data[60] = this->context.bitsize >> 24;
+			this->context.data[59] = this->context.bitsize >> 32;
+			this->context.data[58] = this->context.bitsize >> 40;
+			this->context.data[57] = this->context.bitsize >> 48;
+			this->context.data[56] = this->context.bitsize >> 56;
+			this->ctx_transform(this->context.data);
+
+			for (L = 0; L < 4; ++L) {
+				this->context.digest[L] = (this->context.state[0] >> (24 - L * 8)) & 0x000000ff;
+				this->context.digest[L + 4] = (this->context.state[1] >> (24 - L * 8)) & 0x000000ff;
+				this->context.digest[L + 8] = (this->context.state[2] >> (24 - L * 8)) & 0x000000ff;
+				this->context.digest[L + 12] = (this->context.state[3] >> (24 - L * 8)) & 0x000000ff;
+				this->context.digest[L + 16] = (this->context.state[4] >> (24 - L * 8)) & 0x000000ff;
+			}
+		}
+		inline std::string SHA1::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA1::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[64] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-224
+		inline void hashpp::SHA::SHA2_224::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				0, 0
+			};
+		}
+		inline void hashpp::SHA::SHA2_224::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha256_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_224::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 64 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.bitsize += 512;
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
+
+			// full blocks are transformed straight from the input, in one run so
+			// that multi-block kernels see consecutive blocks
+			if (len >= 64) {
+				hashpp::simd::sha256_blocks(this->context.state, data, len / 64);
+				this->context.bitsize += static_cast<uint64_t>(len / 64) * 512;
+				data += len & ~static_cast<size_t>(63);
+				len &= 63;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
+			}
+		}
+		inline void hashpp::SHA::SHA2_224::ctx_final() {
+			uint32_t i = this->context.size;
+
+			if (this->context.size < 56) {
+				this->context.data[i++] = 0x80;
+				while (i < 56) {
+					this->context.data[i++] = 0x00;
+				}
+			}
+			else {
+				this->context.data[i++] = 0x80;
+				while (i < 64) {
+					this->context.data[i++] = 0x00;
+				}
+				this->ctx_transform(this->context.data);
+				memset(this->context.data, 0, 56);
+			}
+
+			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
+			this->context.data[63] = this->context.bitsize;
+			this->context.data[62] = this->context.bitsize >> 8;
+			this->context.data[61] = this->context.bitsize >> 16;
+			this->context.data[60] = this->context.bitsize >> 24;
+			this->context.data[59] = this->context.bitsize >> 32;
+			this->context.data[58] = this->context.bitsize >> 40;
+			this->context.data[57] = this->context.bitsize >> 48;
+			this->context.data[56] = this->context.bitsize >> 56;
+			this->ctx_transform(this->context.data);
+
+			for (i = 0; i < 4; ++i) {
+				this->context.digest[i] = (this->context.state[0] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 4] = (this->context.state[1] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 8] = (this->context.state[2] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 12] = (this->context.state[3] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 16] = (this->context.state[4] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 20] = (this->context.state[5] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 24] = (this->context.state[6] >> (24 - i * 8)) & 0x000000ff;
+			}
+		}
+		inline std::string SHA2_224::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA2_224::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[64] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-256
+		inline void hashpp::SHA::SHA2_256::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				0, 0
+			};
+		}
+		inline void hashpp::SHA::SHA2_256::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha256_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_256::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 64 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.bitsize += 512;
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
+
+			// full blocks are transformed straight from the input, in one run so
+			// that multi-block kernels see consecutive blocks
+			if (len >= 64) {
+				hashpp::simd::sha256_blocks(this->context.state, data, len / 64);
+				this->context.bitsize += static_cast<uint64_t>(len / 64) * 512;
+				data += len & ~static_cast<size_t>(63);
+				len &= 63;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
+			}
+		}
+		inline void hashpp::SHA::SHA2_256::ctx_final() {
+			uint32_t i = this->context.size;
+
+			if (this->context.size < 56) {
+				this->context.data[i++] = 0x80;
+				while (i < 56) {
+					this->context.data[i++] = 0x00;
+				}
+			}
+			else {
+				this->context.data[i++] = 0x80;
+				while (i < 64) {
+					this->context.data[i++] = 0x00;
+				}
+				this->ctx_transform(this->context.data);
+				memset(this->context.data, 0, 56);
+			}
+
+			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
+			this->context.data[63] = this->context.bitsize;
+			this->context.data[62] = this->context.bitsize >> 8;
+			this->context.data[61] = this->context.bitsize >> 16;
+			this->context.data[60] = this->context.bitsize >> 24;
+			this->context.data[59] = this->context.bitsize >> 32;
+			this->context.data[58] = this->context.bitsize >> 40;
+			this->context.data[57] = this->context.bitsize >> 48;
+			this->context.data[56] = this->context.bitsize >> 56;
+			this->ctx_transform(this->context.data);
+
+			for (i = 0; i < 4; ++i) {
+				this->context.digest[i] = (this->context.state[0] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 4] = (this->context.state[1] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 8] = (this->context.state[2] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 12] = (this->context.state[3] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 16] = (this->context.state[4] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 20] = (this->context.state[5] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 24] = (this->context.state[6] >> (24 - i * 8)) & 0x000000ff;
+				this->context.digest[i + 28] = (this->context.state[7] >> (24 - i * 8)) & 0x000000ff;
+			}
+		}
+		inline std::string SHA2_256::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA2_256::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[64] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-384
+		inline void hashpp::SHA::SHA2_384::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				{0, 0}
+			};
+		}
+		inline void hashpp::SHA::SHA2_384::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha512_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_384::ctx_update(const uint8_t* data, size_t len) {
+			size_t left, fill, rlen = len;
+			const uint8_t* ptr = data;
+
+			if (len != 0) {
+
+				left = this->context.count[0] & 0x7F; fill = 128 - left;
+
+				this->context.count[0] += len;
+				if ((this->context.count[0]) < (len)) {
+					(this->context.count[1])++;
+				}
+
+				if ((left > 0) && (rlen >= fill)) {
+					memcpy(this->context.data + left, ptr, fill);
+					this->ctx_transform(this->context.data);
+					ptr += fill;
+					rlen -= fill;
+					left = 0;
+				}
+
+				// full blocks are compressed straight from the input, in one run
+				if (rlen >= 128) {
+					hashpp::simd::sha512_blocks(this->context.state, ptr, rlen / 128);
+					ptr += rlen & ~static_cast<size_t>(127);
+					rlen &= 127;
+				}
+
+				if (rlen > 0) {
+					memcpy(this->context.data + left, ptr, rlen);
+				}
+			}
+		}
+		inline void hashpp::SHA::SHA2_384::ctx_final() {
+			uint32_t block_present = 0;
+			uint8_t last_padded_block[2 * 128];
+
+			memset(last_padded_block, 0, sizeof(last_padded_block));
+
+			block_present = this->context.count[0] % 128;
+			if (block_present != 0) {
+				memcpy(last_padded_block, this->context.data, block_present);
+			}
+
+			last_padded_block[block_present] = 0x80;
+
+			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
+				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+				this->ctx_transform(last_padded_block + 128);
+			}
+			else {
+				PU128B(this->context.count[0], this->context.count[1],
+					last_padded_block,
+					128 - (2 * sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+			}
+
+			PU64B(this->context.state[0], this->context.digest, 0);
+			PU64B(this->context.state[1], this->context.digest, 8);
+			PU64B(this->context.state[2], this->context.digest, 16);
+			PU64B(this->context.state[3], this->context.digest, 24);
+			PU64B(this->context.state[4], this->context.digest, 32);
+			PU64B(this->context.state[5], this->context.digest, 40);
+		}
+		inline std::string SHA2_384::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA2_384::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[128] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-512
+		inline void hashpp::SHA::SHA2_512::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				{0, 0}
+			};
+		}
+		inline void hashpp::SHA::SHA2_512::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha512_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_512::ctx_update(const uint8_t* data, size_t len) {
+			size_t left, fill, rlen = len;
+			const uint8_t* ptr = data;
+
+			if (len != 0) {
+
+				left = this->context.count[0] & 0x7F; fill = 128 - left;
+
+				this->context.count[0] += len;
+				if ((this->context.count[0]) < (len)) {
+					(this->context.count[1])++;
+				}
+
+				if ((left > 0) && (rlen >= fill)) {
+					memcpy(this->context.data + left, ptr, fill);
+					this->ctx_transform(this->context.data);
+					ptr += fill;
+					rlen -= fill;
+					left = 0;
+				}
+
+				// full blocks are compressed straight from the input, in one run
+				if (rlen >= 128) {
+					hashpp::simd::sha512_blocks(this->context.state, ptr, rlen / 128);
+					ptr += rlen & ~static_cast<size_t>(127);
+					rlen &= 127;
+				}
+
+				if (rlen > 0) {
+					memcpy(this->context.data + left, ptr, rlen);
+				}
+			}
+		}
+		inline void hashpp::SHA::SHA2_512::ctx_final() {
+			uint32_t block_present = 0;
+			uint8_t last_padded_block[2 * 128];
+
+			memset(last_padded_block, 0, sizeof(last_padded_block));
+
+			block_present = this->context.count[0] % 128;
+			if (block_present != 0) {
+				memcpy(last_padded_block, this->context.data, block_present);
+			}
+
+			last_padded_block[block_present] = 0x80;
+
+			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
+				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+				this->ctx_transform(last_padded_block + 128);
+			}
+			else {
+				PU128B(this->context.count[0], this->context.count[1],
+					last_padded_block,
+					128 - (2 * sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+			}
+
+			PU64B(this->context.state[0], this->context.digest, 0);
+			PU64B(this->context.state[1], this->context.digest, 8);
+			PU64B(this->context.state[2], this->context.digest, 16);
+			PU64B(this->context.state[3], this->context.digest, 24);
+			PU64B(this->context.state[4], this->context.digest, 32);
+			PU64B(this->context.state[5], this->context.digest, 40);
+			PU64B(this->context.state[6], this->context.digest, 48);
+			PU64B(this->context.state[7], this->context.digest, 56);
+		}
+		inline std::string SHA2_512::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA2_512::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[128] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-512-224
+		inline void hashpp::SHA::SHA2_512_224::ctx_init() {
+			this->context = {
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				{0, 0}
 			};
+		}
+		inline void hashpp::SHA::SHA2_512_224::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha512_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_512_224::ctx_update(const uint8_t* data, size_t len) {
+			size_t left, fill, rlen = len;
+			const uint8_t* ptr = data;
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+			if (len != 0) {
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+				left = this->context.count[0] & 0x7F; fill = 128 - left;
 
-			constexpr uint64_t F(const uint64_t A, const uint64_t B, const uint64_t C);
-			constexpr uint64_t G(const uint64_t A, const uint64_t B, const uint64_t C);
+				this->context.count[0] += len;
+				if ((this->context.count[0]) < (len)) {
+					(this->context.count[1])++;
+				}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			constexpr uint64_t SIGMA0(const uint64_t A);
-			constexpr uint64_t SIGMA1(const uint64_t A);
-			constexpr uint64_t SIGMA2(const uint64_t A);
-			constexpr uint64_t SIGMA3(const uint64_t A);
-		};
-		class SHA2_512_256 : public common {
-		protected:
-			std::vector<uint8_t> getBytes() override {
-				return std::vector<uint8_t>(context.digest, context.digest + 32);
+				if ((left > 0) && (rlen >= fill)) {
+					memcpy(this->context.data + left, ptr, fill);
+					this->ctx_transform(this->context.data);
+					ptr += fill;
+					rlen -= fill;
+					left = 0;
+				}
+
+				// full blocks are compressed straight from the input, in one run
+				if (rlen >= 128) {
+					hashpp::simd::sha512_blocks(this->context.state, ptr, rlen / 128);
+					ptr += rlen & ~static_cast<size_t>(127);
+					rlen &= 127;
+				}
+
+				if (rlen > 0) {
+					memcpy(this->context.data + left, ptr, rlen);
+				}
 			}
+		}
+		inline void hashpp::SHA::SHA2_512_224::ctx_final() {
+			uint32_t block_present = 0;
+			uint8_t last_padded_block[2 * 128];
 
-		private:
-			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 32;
+			memset(last_padded_block, 0, sizeof(last_padded_block));
 
-			typedef struct {
-				uint64_t state[8], count[2];
-				uint8_t  data[128], digest[32];
-			} CTX;
+			block_present = this->context.count[0] % 128;
+			if (block_present != 0) {
+				memcpy(last_padded_block, this->context.data, block_present);
+			}
 
-			CTX context = { 0 };
+			last_padded_block[block_present] = 0x80;
 
-			// constants (H) defined by SHA-512/256 algorithm
-			// as per: https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Standards-and-Guidelines/documents/examples/SHA512_256.pdf
-			const uint64_t H[8] = {
-				0x22312194FC2BF72C,
-				0x9F555FA3C84C64C2,
-				0x2393B86B6F53B151,
-				0x963877195940EABD,
-				0x96283EE2A88EFFE3,
-				0xBE5E1E2553863992,
-				0x2B0199FC2C85B8AA,
-				0x0EB72DDC81C52CA2
-			};
+			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
+				/* We need an additional block */
+				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+				this->ctx_transform(last_padded_block + 128);
+			}
+			else {
+				PU128B(this->context.count[0], this->context.count[1],
+					last_padded_block,
+					128 - (2 * sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+			}
 
-			// more constants (K)... as per above
-			const uint64_t K[80] = {
-				0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
-				0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
-				0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
-				0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
-				0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
-				0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
-				0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
-				0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
-				0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
-				0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
-				0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30,
-				0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
-				0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
-				0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
-				0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC,
-				0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
-				0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
-				0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
-				0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
-				0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
-			};
+			PU64B(this->context.state[0], this->context.digest, 0);
+			PU64B(this->context.state[1], this->context.digest, 8);
+			PU64B(this->context.state[2], this->context.digest, 16);
+			PU64B(this->context.state[3], this->context.digest, 24);
+		}
+		inline std::string SHA2_512_224::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA2_512_224::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[128] = {0};
 
-			// the byte 0x36 repeated 'B' times where 'B' => block size
-			std::vector<uint8_t> ipad = {
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36
-			};
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
 
-			// the byte 0x5c repeated 'B' times
-			std::vector<uint8_t> opad = {
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
-				0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c
-			};
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
 
-			inline void ctx_init() override;
-			inline void ctx_transform(const uint8_t* data);
-			inline void ctx_update(const uint8_t* data, size_t len) override;
-			inline void ctx_final() override;
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
 
-			inline std::string _H(const std::string& a, const std::string& b) override;
-			inline std::string HMAC(const std::string& key, const std::string& data) override;
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
 
-			constexpr uint64_t F(const uint64_t A, const uint64_t B, const uint64_t C);
-			constexpr uint64_t G(const uint64_t A, const uint64_t B, const uint64_t C);
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
 
-			// Sigma functions
-			// as per: https://datatracker.ietf.org/doc/html/rfc4634
-			constexpr uint64_t SIGMA0(const uint64_t A);
-			constexpr uint64_t SIGMA1(const uint64_t A);
-			constexpr uint64_t SIGMA2(const uint64_t A);
-			constexpr uint64_t SIGMA3(const uint64_t A);
-		};
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
 
-		// SHA-1
-		inline void hashpp::SHA::SHA1::ctx_init() {
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA2-512-256
+		inline void hashpp::SHA::SHA2_512_256::ctx_init() {
 			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3], this->H[4]},
-				{this->K[0], this->K[1], this->K[2], this->K[3]},
-				0, 0
+				{this->H[0], this->H[1], this->H[2], this->H[3],
+					this->H[4], this->H[5], this->H[6], this->H[7]},
+				{0, 0}
 			};
 		}
-		inline void hashpp::SHA::SHA1::ctx_transform(const uint8_t* data) {
-			uint32_t t, m[80], i = 0, j = 0;
+		inline void hashpp::SHA::SHA2_512_256::ctx_transform(const uint8_t* data) {
+			hashpp::simd::sha512_blocks(this->context.state, data, 1);
+		}
+		inline void hashpp::SHA::SHA2_512_256::ctx_update(const uint8_t* data, size_t len) {
+			size_t left, fill, rlen = len;
+			const uint8_t* ptr = data;
 
-			for (; i < 16; ++i, j += 4) {
-				m[i] = this->A(data[j], data[j + 1], data[j + 2], data[j + 3]);
-			}
-			for (; i < 80; ++i) {
-				m[i] = this->B(m[i - 3], m[i - 8], m[i - 14], m[i - 16]);
-				m[i] = this->C(m[i]);
-			}
+			if (len != 0) {
 
-			uint32_t results[5] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4]
-			};
+				left = this->context.count[0] & 0x7F; fill = 128 - left;
 
-			for (i = 0; i < 20; ++i) {
-				t = this->rl32(results[0], 5) + (F(results[1], results[2], results[3])) + results[4] + this->context.k[0] + m[i];
-				results[4] = results[3];
-				results[3] = results[2];
-				results[2] = this->rl32(results[1], 30);
-				results[1] = results[0];
-				results[0] = t;
-			}
-			for (; i < 40; ++i) {
-				t = this->rl32(results[0], 5) + (J(results[1], results[2], results[3])) + results[4] + this->context.k[1] + m[i];
-				results[4] = results[3];
-				results[3] = results[2];
-				results[2] = this->rl32(results[1], 30);
-				results[1] = results[0];
-				results[0] = t;
-			}
-			for (; i < 60; ++i) {
-				t = this->rl32(results[0], 5) + ((G(results[1], results[2], results[3]))) + results[4] + this->context.k[2] + m[i];
-				results[4] = results[3];
-				results[3] = results[2];
-				results[2] = this->rl32(results[1], 30);
-				results[1] = results[0];
-				results[0] = t;
-			}
-			for (; i < 80; ++i) {
-				t = this->rl32(results[0], 5) + (J(results[1], results[2], results[3])) + results[4] + this->context.k[3] + m[i];
-				results[4] = results[3];
-				results[3] = results[2];
-				results[2] = this->rl32(results[1], 30);
-				results[1] = results[0];
-				results[0] = t;
-			}
-
-			for (uint32_t z = 0; z < 5; z++) {
-				this->context.state[z] += results[z];
-			}
-		}
-		inline void hashpp::SHA::SHA1::ctx_update(const uint8_t* data, size_t len) {
-			size_t i;
+				this->context.count[0] += len;
+				if ((this->context.count[0]) < (len)) {
+					(this->context.count[1])++;
+				}
 
-			for (i = 0; i < len; ++i) {
-				this->context.data[this->context.size] = data[i];
-				this->context.size++;
-				if (this->context.size == 64) {
+				if ((left > 0) && (rlen >= fill)) {
+					memcpy(this->context.data + left, ptr, fill);
 					this->ctx_transform(this->context.data);
-					this->context.bitsize += 512;
-					this->context.size = 0;
+					ptr += fill;
+					rlen -= fill;
+					left = 0;
 				}
-			}
-		}
-		inline void hashpp::SHA::SHA1::ctx_final() {
-			uint32_t L = this->context.size;
 
-			if (this->context.size < 56) {
-				this->context.data[L++] = 0x80;
-				while (L < 56) {
-					this->context.data[L++] = 0x00;
+				// full blocks are compressed straight from the input, in one run
+				if (rlen >= 128) {
+					hashpp::simd::sha512_blocks(this->context.state, ptr, rlen / 128);
+					ptr += rlen & ~static_cast<size_t>(127);
+					rlen &= 127;
 				}
-			}
-			else {
-				this->context.data[L++] = 0x80;
-				while (L < 64) {
-					this->context.data[L++] = 0x00;
+
+				if (rlen > 0) {
+					memcpy(this->context.data + left, ptr, rlen);
 				}
-				this->ctx_transform(this->context.data);
-				memset(this->context.data, 0, 56);
 			}
+		}
+		inline void hashpp::SHA::SHA2_512_256::ctx_final() {
+			uint32_t block_present = 0;
+			uint8_t last_padded_block[2 * 128];
 
-			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
-			this->context.data[63] = this->context.bitsize;
-			this->context.data[62] = this->context.bitsize >> 8;
-			this->context.data[61] = this->context.bitsize >> 16;
-			this->context.data[60] = this->context.bitsize >> 24;
-			this->context.data[59] = this->context.bitsize >> 32;
-			this->context.data[58] = this->context.bitsize >> 40;
-			this->context.data[57] = this->context.bitsize >> 48;
-			this->context.data[56] = this->context.bitsize >> 56;
-			this->ctx_transform(this->context.data);
+			memset(last_padded_block, 0, sizeof(last_padded_block));
 
-			for (L = 0; L < 4; ++L) {
-				this->context.digest[L] = (this->context.state[0] >> (24 - L * 8)) & 0x000000ff;
-				this->context.digest[L + 4] = (this->context.state[1] >> (24 - L * 8)) & 0x000000ff;
-				this->context.digest[L + 8] = (this->context.state[2] >> (24 - L * 8)) & 0x000000ff;
-				this->context.digest[L + 12] = (this->context.state[3] >> (24 - L * 8)) & 0x000000ff;
-				this->context.digest[L + 16] = (this->context.state[4] >> (24 - L * 8)) & 0x000000ff;
+			block_present = this->context.count[0] % 128;
+			if (block_present != 0) {
+				memcpy(last_padded_block, this->context.data, block_present);
+			}
+
+			last_padded_block[block_present] = 0x80;
+
+			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
+				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
+				this->ctx_transform(last_padded_block + 128);
+			}
+			else {
+				PU128B(this->context.count[0], this->context.count[1],
+					last_padded_block,
+					128 - (2 * sizeof(uint64_t)));
+				this->ctx_transform(last_padded_block);
 			}
+
+			PU64B(this->context.state[0], this->context.digest, 0);
+			PU64B(this->context.state[1], this->context.digest, 8);
+			PU64B(this->context.state[2], this->context.digest, 16);
+			PU64B(this->context.state[3], this->context.digest, 24);
 		}
-		inline std::string SHA1::_H(const std::string& a, const std::string& b) {
+		inline std::string SHA2_512_256::_H(const std::string& a, const std::string& b) {
 			return this->getHash(a + b);
 		}
-		inline std::string SHA1::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[64] = {0};
+		inline std::string SHA2_512_256::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[128] = {0};
 
 			// (1) append zeros to the end of K to create a B byte string
 			// (e.g., if K is of length 20 bytes and B = 64, then K will be
@@ -1784,120 +6676,161 @@ namespace hashpp {
 			// (7) apply H to the stream generated in step (6) and output the result
 			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
 		}
-		constexpr uint32_t hashpp::SHA::SHA1::A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D) {
-			return ((A << 24) + (B << 16) + (C << 8) + (D));
-		}
-		constexpr uint32_t hashpp::SHA::SHA1::B(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D) {
-			return ((A ^ B ^ C ^ D));
-		}
-		constexpr uint32_t hashpp::SHA::SHA1::C(const uint32_t A) { return ((A << 1) | (A >> 31)); }
-		constexpr uint32_t hashpp::SHA::SHA1::F(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (~B & D)); }
-		constexpr uint32_t hashpp::SHA::SHA1::G(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (B & D) ^ (C & D)); }
-		constexpr uint32_t hashpp::SHA::SHA1::J(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B ^ C ^ D)); }
 
-		// SHA2-224
-		inline void hashpp::SHA::SHA2_224::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				0, 0
-			};
+		// SHA3-224
+		inline void hashpp::SHA::SHA3_224::ctx_init() {
+			this->context = { {0}, 0 };
 		}
-		inline void hashpp::SHA::SHA2_224::ctx_transform(const uint8_t* data) {
-			uint32_t m[64], i = 0, j = 0;
-
-			for (; i < 16; ++i, j += 4) {
-				m[i] = this->A(data[j], data[j + 1], data[j + 2], data[j + 3]);
-			}			for (; i < 64; ++i) {
-				m[i] = this->SIGMA3(m[i - 2]) + m[i - 7] + this->SIGMA2(m[i - 15]) + m[i - 16];
-			}
-
-			uint32_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
+		inline void hashpp::SHA::SHA3_224::ctx_transform(const uint8_t* data) {
+			hashpp::simd::keccak_blocks(this->context.state, data, 1, 144);
+		}
+		inline void hashpp::SHA::SHA3_224::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 144 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
 
-			uint32_t t1, t2;
-			for (i = 0; i < 64; ++i) {
-				t1 = results[7] + this->SIGMA1(results[4]) + this->F(results[4], results[5], results[6]) + this->K[i] + m[i];
-				t2 = this->SIGMA0(results[0]) + this->G(results[0], results[1], results[2]);
-				results[7] = results[6];
-				results[6] = results[5];
-				results[5] = results[4];
-				results[4] = results[3] + t1;
-				results[3] = results[2];
-				results[2] = results[1];
-				results[1] = results[0];
-				results[0] = t1 + t2;
+			// full blocks are absorbed straight from the input, in one run so
+			// that the state stays in registers between them
+			if (len >= 144) {
+				hashpp::simd::keccak_blocks(this->context.state, data, len / 144, 144);
+				data += len - len % 144;
+				len %= 144;
 			}
 
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
 			}
 		}
-		inline void hashpp::SHA::SHA2_224::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t i;
+		inline void hashpp::SHA::SHA3_224::ctx_final() {
+			const uint32_t L = this->context.size;
 
-			for (i = 0; i < len; ++i) {
-				this->context.data[this->context.size] = data[i];
-				this->context.size++;
-				if (this->context.size == 64) {
-					this->ctx_transform(this->context.data);
-					this->context.bitsize += 512;
-					this->context.size = 0;
-				}
-			}
+			// the SHA-3 domain separation bits (01) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 144 - L);
+			this->context.data[L] = 0x06;
+			this->context.data[143] |= 0x80;
+			this->ctx_transform(this->context.data);
+
+			hashpp::simd::keccak_extract(this->context.state, this->context.digest, 28);
 		}
-		inline void hashpp::SHA::SHA2_224::ctx_final() {
-			uint32_t i = this->context.size;
+		inline std::string SHA3_224::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA3_224::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[144] = {0};
 
-			if (this->context.size < 56) {
-				this->context.data[i++] = 0x80;
-				while (i < 56) {
-					this->context.data[i++] = 0x00;
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
 				}
 			}
 			else {
-				this->context.data[i++] = 0x80;
-				while (i < 64) {
-					this->context.data[i++] = 0x00;
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
 				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
+
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
+			}
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
+			}
+
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
+			}
+
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+		}
+
+		// SHA3-256
+		inline void hashpp::SHA::SHA3_256::ctx_init() {
+			this->context = { {0}, 0 };
+		}
+		inline void hashpp::SHA::SHA3_256::ctx_transform(const uint8_t* data) {
+			hashpp::simd::keccak_blocks(this->context.state, data, 1, 136);
+		}
+		inline void hashpp::SHA::SHA3_256::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 136 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
 				this->ctx_transform(this->context.data);
-				memset(this->context.data, 0, 56);
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
 			}
 
-			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
-			this->context.data[63] = this->context.bitsize;
-			this->context.data[62] = this->context.bitsize >> 8;
-			this->context.data[61] = this->context.bitsize >> 16;
-			this->context.data[60] = this->context.bitsize >> 24;
-			this->context.data[59] = this->context.bitsize >> 32;
-			this->context.data[58] = this->context.bitsize >> 40;
-			this->context.data[57] = this->context.bitsize >> 48;
-			this->context.data[56] = this->context.bitsize >> 56;
-			this->ctx_transform(this->context.data);
+			// full blocks are absorbed straight from the input, in one run so
+			// that the state stays in registers between them
+			if (len >= 136) {
+				hashpp::simd::keccak_blocks(this->context.state, data, len / 136, 136);
+				data += len - len % 136;
+				len %= 136;
+			}
 
-			for (i = 0; i < 4; ++i) {
-				this->context.digest[i] = (this->context.state[0] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 4] = (this->context.state[1] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 8] = (this->context.state[2] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 12] = (this->context.state[3] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 16] = (this->context.state[4] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 20] = (this->context.state[5] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 24] = (this->context.state[6] >> (24 - i * 8)) & 0x000000ff;
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
 			}
 		}
-		inline std::string SHA2_224::_H(const std::string& a, const std::string& b) {
+		inline void hashpp::SHA::SHA3_256::ctx_final() {
+			const uint32_t L = this->context.size;
+
+			// the SHA-3 domain separation bits (01) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 136 - L);
+			this->context.data[L] = 0x06;
+			this->context.data[135] |= 0x80;
+			this->ctx_transform(this->context.data);
+
+			hashpp::simd::keccak_extract(this->context.state, this->context.digest, 32);
+		}
+		inline std::string SHA3_256::_H(const std::string& a, const std::string& b) {
 			return this->getHash(a + b);
 		}
-		inline std::string SHA2_224::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[64] = {0};
+		inline std::string SHA3_256::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[136] = {0};
 
 			// (1) append zeros to the end of K to create a B byte string
 			// (e.g., if K is of length 20 bytes and B = 64, then K will be
@@ -1947,121 +6880,161 @@ namespace hashpp {
 			// (7) apply H to the stream generated in step (6) and output the result
 			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
 		}
-		constexpr uint32_t hashpp::SHA::SHA2_224::A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D) {
-			return ((A << 24) + (B << 16) + (C << 8) + (D));
+
+		// SHA3-384
+		inline void hashpp::SHA::SHA3_384::ctx_init() {
+			this->context = { {0}, 0 };
+		}
+		inline void hashpp::SHA::SHA3_384::ctx_transform(const uint8_t* data) {
+			hashpp::simd::keccak_blocks(this->context.state, data, 1, 104);
 		}
-		constexpr uint32_t hashpp::SHA::SHA2_224::F(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (~B & D)); }
-		constexpr uint32_t hashpp::SHA::SHA2_224::G(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (B & D) ^ (C & D)); }
-		constexpr uint32_t hashpp::SHA::SHA2_224::SIGMA0(const uint32_t A) { return (this->rr32(A, 2) ^ this->rr32(A, 13) ^ this->rr32(A, 22)); }
-		constexpr uint32_t hashpp::SHA::SHA2_224::SIGMA1(const uint32_t A) { return (this->rr32(A, 6) ^ this->rr32(A, 11) ^ this->rr32(A, 25)); }
-		constexpr uint32_t hashpp::SHA::SHA2_224::SIGMA2(const uint32_t A) { return (this->rr32(A, 7) ^ this->rr32(A, 18) ^ ((A) >> 3)); }
-		constexpr uint32_t hashpp::SHA::SHA2_224::SIGMA3(const uint32_t A) { return (this->rr32(A, 17) ^ this->rr32(A, 19) ^ ((A) >> 10)); }
+		inline void hashpp::SHA::SHA3_384::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 104 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
 
-		// SHA2-256
-		inline void hashpp::SHA::SHA2_256::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				0, 0
-			};
+			// full blocks are absorbed straight from the input, in one run so
+			// that the state stays in registers between them
+			if (len >= 104) {
+				hashpp::simd::keccak_blocks(this->context.state, data, len / 104, 104);
+				data += len - len % 104;
+				len %= 104;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
+			}
 		}
-		inline void hashpp::SHA::SHA2_256::ctx_transform(const uint8_t* data) {
-			uint32_t m[64], i = 0, j = 0;
+		inline void hashpp::SHA::SHA3_384::ctx_final() {
+			const uint32_t L = this->context.size;
+
+			// the SHA-3 domain separation bits (01) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 104 - L);
+			this->context.data[L] = 0x06;
+			this->context.data[103] |= 0x80;
+			this->ctx_transform(this->context.data);
+
+			hashpp::simd::keccak_extract(this->context.state, this->context.digest, 48);
+		}
+		inline std::string SHA3_384::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string SHA3_384::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[104] = {0};
+
+			// (1) append zeros to the end of K to create a B byte string
+			// (e.g., if K is of length 20 bytes and B = 64, then K will be
+			//	appended with 44 zero bytes 0x00) where B is the block size
+			if (key.length() > this->BLOCK_SIZE) {
+				// if K is longer than B bytes, reset K to K=H(K)
+				// where K can either be composed of entirely bytes of H(K)
+				// (if H(K) == L [where L => digest]) or the first L bytes of
+				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
+				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+					k[i] = k_[i];
+				}
+			}
+			else {
+				// if K is shorter than B bytes, append zeros to the end of K
+				// until K is B bytes long
+				for (uint32_t i = 0; i < key.length(); ++i) {
+					k[i] = key[i];
+				}
+			}
+
+			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->ipad[i] ^= k[i];
+			}
 
-			for (; i < 16; ++i, j += 4) {
-				m[i] = this->A(data[j], data[j + 1], data[j + 2], data[j + 3]);
+			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
+			for (uint32_t i = 0; i < data.length(); ++i) {
+				this->ipad.push_back(data[i]);
 			}
-			for (; i < 64; ++i) {
-				m[i] = this->SIGMA3(m[i - 2]) + m[i - 7] + this->SIGMA2(m[i - 15]) + m[i - 16];
+
+			// (4) apply H to the stream generated in step (3)
+			// see step (6)
+
+			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
+			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
+				this->opad[i] ^= k[i];
 			}
 
-			uint32_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
-
-			uint32_t t1, t2;
-			for (i = 0; i < 64; ++i) {
-				t1 = results[7] + this->SIGMA1(results[4]) + this->F(results[4], results[5], results[6]) + this->K[i] + m[i];
-				t2 = this->SIGMA0(results[0]) + this->G(results[0], results[1], results[2]);
-				results[7] = results[6];
-				results[6] = results[5];
-				results[5] = results[4];
-				results[4] = results[3] + t1;
-				results[3] = results[2];
-				results[2] = results[1];
-				results[1] = results[0];
-				results[0] = t1 + t2;
+			// (6) append the H result from step (4) to the B byte string resulting from step (5)
+			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				this->opad.push_back(h_[i]);
 			}
 
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
-			}
+			// (7) apply H to the stream generated in step (6) and output the result
+			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
 		}
-		inline void hashpp::SHA::SHA2_256::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t i;
 
-			for (i = 0; i < len; ++i) {
-				this->context.data[this->context.size] = data[i];
-				this->context.size++;
-				if (this->context.size == 64) {
-					this->ctx_transform(this->context.data);
-					this->context.bitsize += 512;
-					this->context.size = 0;
-				}
-			}
+		// SHA3-512
+		inline void hashpp::SHA::SHA3_512::ctx_init() {
+			this->context = { {0}, 0 };
 		}
-		inline void hashpp::SHA::SHA2_256::ctx_final() {
-			uint32_t i = this->context.size;
+		inline void hashpp::SHA::SHA3_512::ctx_transform(const uint8_t* data) {
+			hashpp::simd::keccak_blocks(this->context.state, data, 1, 72);
+		}
+		inline void hashpp::SHA::SHA3_512::ctx_update(const uint8_t* data, size_t len) {
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 72 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				this->ctx_transform(this->context.data);
+				this->context.size = 0;
+				data += fill;
+				len -= fill;
+			}
 
-			if (this->context.size < 56) {
-				this->context.data[i++] = 0x80;
-				while (i < 56) {
-					this->context.data[i++] = 0x00;
-				}
+			// full blocks are absorbed straight from the input, in one run so
+			// that the state stays in registers between them
+			if (len >= 72) {
+				hashpp::simd::keccak_blocks(this->context.state, data, len / 72, 72);
+				data += len - len % 72;
+				len %= 72;
 			}
-			else {
-				this->context.data[i++] = 0x80;
-				while (i < 64) {
-					this->context.data[i++] = 0x00;
-				}
-				this->ctx_transform(this->context.data);
-				memset(this->context.data, 0, 56);
+
+			if (len != 0) {
+				memcpy(this->context.data, data, len);
+				this->context.size = static_cast<uint32_t>(len);
 			}
+		}
+		inline void hashpp::SHA::SHA3_512::ctx_final() {
+			const uint32_t L = this->context.size;
 
-			this->context.bitsize += static_cast<uint64_t>(this->context.size) * 8;
-			this->context.data[63] = this->context.bitsize;
-			this->context.data[62] = this->context.bitsize >> 8;
-			this->context.data[61] = this->context.bitsize >> 16;
-			this->context.data[60] = this->context.bitsize >> 24;
-			this->context.data[59] = this->context.bitsize >> 32;
-			this->context.data[58] = this->context.bitsize >> 40;
-			this->context.data[57] = this->context.bitsize >> 48;
-			this->context.data[56] = this->context.bitsize >> 56;
+			// the SHA-3 domain separation bits (01) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 72 - L);
+			this->context.data[L] = 0x06;
+			this->context.data[71] |= 0x80;
 			this->ctx_transform(this->context.data);
 
-			for (i = 0; i < 4; ++i) {
-				this->context.digest[i] = (this->context.state[0] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 4] = (this->context.state[1] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 8] = (this->context.state[2] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 12] = (this->context.state[3] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 16] = (this->context.state[4] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 20] = (this->context.state[5] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 24] = (this->context.state[6] >> (24 - i * 8)) & 0x000000ff;
-				this->context.digest[i + 28] = (this->context.state[7] >> (24 - i * 8)) & 0x000000ff;
-			}
+			hashpp::simd::keccak_extract(this->context.state, this->context.digest, 64);
 		}
-		inline std::string SHA2_256::_H(const std::string& a, const std::string& b) {
+		inline std::string SHA3_512::_H(const std::string& a, const std::string& b) {
 			return this->getHash(a + b);
 		}
-		inline std::string SHA2_256::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[64] = {0};
+		inline std::string SHA3_512::HMAC(const std::string& key, const std::string& data) {
+			uint8_t k[72] = {0};
 
 			// (1) append zeros to the end of K to create a B byte string
 			// (e.g., if K is of length 20 bytes and B = 64, then K will be
@@ -2111,744 +7084,1299 @@ namespace hashpp {
 			// (7) apply H to the stream generated in step (6) and output the result
 			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
 		}
-		constexpr uint32_t hashpp::SHA::SHA2_256::A(const uint32_t A, const uint32_t B, const uint32_t C, const uint32_t D) {
-			return ((A << 24) + (B << 16) + (C << 8) + (D));
+
+		// SHAKE128
+		inline bool hashpp::SHA::SHAKE128::update(const void* data, size_t len) {
+			const uint8_t* in = static_cast<const uint8_t*>(data);
+
+			if (this->context.squeezing) {
+				return false;
+			}
+
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 168 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, in, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return true;
+				}
+				memcpy(this->context.data + this->context.size, in, fill);
+				hashpp::simd::keccak_blocks(this->context.state, this->context.data, 1, 168);
+				this->context.size = 0;
+				in += fill;
+				len -= fill;
+			}
+
+			if (len >= 168) {
+				hashpp::simd::keccak_blocks(this->context.state, in, len / 168, 168);
+				in += len - len % 168;
+				len %= 168;
+			}
+
+			if (len != 0) {
+				memcpy(this->context.data, in, len);
+				this->context.size = static_cast<uint32_t>(len);
+			}
+			return true;
+		}
+		inline void hashpp::SHA::SHAKE128::squeeze(void* out, size_t n) {
+			uint8_t* o = static_cast<uint8_t*>(out);
+
+			if (!this->context.squeezing) {
+				this->ctx_final();
+			}
+
+			// the rest of the current block of output
+			size_t take = n < 168 - this->context.size ? n : 168 - this->context.size;
+			memcpy(o, this->context.data + this->context.size, take);
+			this->context.size += static_cast<uint32_t>(take);
+			o += take;
+			n -= take;
+
+			// whole blocks are written straight to 'out'
+			for (; n >= 168; n -= 168, o += 168) {
+				hashpp::simd::keccak_blocks(this->context.state, nullptr, 1, 0);
+				hashpp::simd::keccak_extract(this->context.state, o, 168);
+			}
+
+			if (n != 0) {
+				hashpp::simd::keccak_blocks(this->context.state, nullptr, 1, 0);
+				hashpp::simd::keccak_extract(this->context.state, this->context.data, 168);
+				memcpy(o, this->context.data, n);
+				this->context.size = static_cast<uint32_t>(n);
+			}
 		}
-		constexpr uint32_t hashpp::SHA::SHA2_256::F(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (~B & D)); }
-		constexpr uint32_t hashpp::SHA::SHA2_256::G(const uint32_t B, const uint32_t C, const uint32_t D) { return ((B & C) ^ (B & D) ^ (C & D)); }
-		constexpr uint32_t hashpp::SHA::SHA2_256::SIGMA0(const uint32_t A) { return (this->rr32(A, 2) ^ this->rr32(A, 13) ^ this->rr32(A, 22)); }
-		constexpr uint32_t hashpp::SHA::SHA2_256::SIGMA1(const uint32_t A) { return (this->rr32(A, 6) ^ this->rr32(A, 11) ^ this->rr32(A, 25)); }
-		constexpr uint32_t hashpp::SHA::SHA2_256::SIGMA2(const uint32_t A) { return (this->rr32(A, 7) ^ this->rr32(A, 18) ^ ((A) >> 3)); }
-		constexpr uint32_t hashpp::SHA::SHA2_256::SIGMA3(const uint32_t A) { return (this->rr32(A, 17) ^ this->rr32(A, 19) ^ ((A) >> 10)); }
+		inline void hashpp::SHA::SHAKE128::ctx_final() {
+			uint32_t L = this->context.size;
 
-		// SHA2-384
-		inline void hashpp::SHA::SHA2_384::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				{0, 0}
-			};
+			// the SHAKE domain separation bits (1111) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 168 - L);
+			this->context.data[L] = 0x1F;
+			this->context.data[167] |= 0x80;
+			hashpp::simd::keccak_blocks(this->context.state, this->context.data, 1, 168);
+
+			hashpp::simd::keccak_extract(this->context.state, this->context.data, 168);
+			this->context.size = 0;
+			this->context.squeezing = true;
 		}
-		inline void hashpp::SHA::SHA2_384::ctx_transform(const uint8_t* data) {
-			uint64_t W[80];
-			uint32_t i;
-
-			uint64_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
+		inline std::string hashpp::SHA::SHAKE128::getHash(const std::string& data) {
+			this->reset();
+			this->update(data);
+			return this->hexDigest();
+		}
+		inline std::string hashpp::SHA::SHAKE128::getHash(const std::filesystem::path& path) {
+			std::ifstream file(path, std::ios::binary);
+			std::vector<char> buf(1024 * 1024, 0);
 
-			for (i = 0; i < 16; i++) {
-				GU64B(W[i], data, 8 * i);
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (i = 16; i < 80; i++) {
-				W[i] = this->SIGMA3(W[i - 2]) + W[i - 7] + this->SIGMA2(W[i - 15]) + W[i - 16];
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
+			this->reset();
+			while (file) {
+				file.read(buf.data(), buf.size());
+				this->update(buf.data(), static_cast<size_t>(file.gcount()));
 			}
+			return this->hexDigest();
 		}
-		inline void hashpp::SHA::SHA2_384::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t left, fill, rlen = len;
-			const uint8_t* ptr = data;
+		inline std::string hashpp::SHA::SHAKE128::hexDigest() {
+			const char* digits = "0123456789abcdef";
+			uint8_t digest[32];
+			std::string hash(64, '0');
 
-			if (len != 0) {
+			this->squeeze(digest, sizeof(digest));
+			for (uint32_t i = 0; i < 32; ++i) {
+				hash[i * 2] = digits[digest[i] >> 4];
+				hash[i * 2 + 1] = digits[digest[i] & 0x0F];
+			}
+			return hash;
+		}
 
-				left = this->context.count[0] & 0x7F; fill = 128 - left;
+		// SHAKE256
+		inline bool hashpp::SHA::SHAKE256::update(const void* data, size_t len) {
+			const uint8_t* in = static_cast<const uint8_t*>(data);
 
-				this->context.count[0] += len;
-				if ((this->context.count[0]) < (len)) {
-					(this->context.count[1])++;
-				}
+			if (this->context.squeezing) {
+				return false;
+			}
 
-				if ((left > 0) && (rlen >= fill)) {
-					memcpy(this->context.data + left, ptr, fill);
-					this->ctx_transform(this->context.data);
-					ptr += fill;
-					rlen -= fill;
-					left = 0;
+			// complete a buffered partial block first
+			if (this->context.size != 0) {
+				size_t fill = 136 - this->context.size;
+				if (len < fill) {
+					memcpy(this->context.data + this->context.size, in, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return true;
 				}
+				memcpy(this->context.data + this->context.size, in, fill);
+				hashpp::simd::keccak_blocks(this->context.state, this->context.data, 1, 136);
+				this->context.size = 0;
+				in += fill;
+				len -= fill;
+			}
 
-				while (rlen >= 128) {
-					this->ctx_transform(ptr);
-					ptr += 128;
-					rlen -= 128;
-				}
+			if (len >= 136) {
+				hashpp::simd::keccak_blocks(this->context.state, in, len / 136, 136);
+				in += len - len % 136;
+				len %= 136;
+			}
 
-				if (rlen > 0) {
-					memcpy(this->context.data + left, ptr, rlen);
-				}
+			if (len != 0) {
+				memcpy(this->context.data, in, len);
+				this->context.size = static_cast<uint32_t>(len);
 			}
+			return true;
 		}
-		inline void hashpp::SHA::SHA2_384::ctx_final() {
-			uint32_t block_present = 0;
-			uint8_t last_padded_block[2 * 128];
+		inline void hashpp::SHA::SHAKE256::squeeze(void* out, size_t n) {
+			uint8_t* o = static_cast<uint8_t*>(out);
 
-			memset(last_padded_block, 0, sizeof(last_padded_block));
+			if (!this->context.squeezing) {
+				this->ctx_final();
+			}
 
-			block_present = this->context.count[0] % 128;
-			if (block_present != 0) {
-				memcpy(last_padded_block, this->context.data, block_present);
+			// the rest of the current block of output
+			size_t take = n < 136 - this->context.size ? n : 136 - this->context.size;
+			memcpy(o, this->context.data + this->context.size, take);
+			this->context.size += static_cast<uint32_t>(take);
+			o += take;
+			n -= take;
+
+			// whole blocks are written straight to 'out'
+			for (; n >= 136; n -= 136, o += 136) {
+				hashpp::simd::keccak_blocks(this->context.state, nullptr, 1, 0);
+				hashpp::simd::keccak_extract(this->context.state, o, 136);
 			}
 
-			last_padded_block[block_present] = 0x80;
+			if (n != 0) {
+				hashpp::simd::keccak_blocks(this->context.state, nullptr, 1, 0);
+				hashpp::simd::keccak_extract(this->context.state, this->context.data, 136);
+				memcpy(o, this->context.data, n);
+				this->context.size = static_cast<uint32_t>(n);
+			}
+		}
+		inline void hashpp::SHA::SHAKE256::ctx_final() {
+			uint32_t L = this->context.size;
 
-			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
-				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
-				this->ctx_transform(last_padded_block + 128);
+			// the SHAKE domain separation bits (1111) followed by the pad10*1 padding
+			memset(this->context.data + L, 0, 136 - L);
+			this->context.data[L] = 0x1F;
+			this->context.data[135] |= 0x80;
+			hashpp::simd::keccak_blocks(this->context.state, this->context.data, 1, 136);
+
+			hashpp::simd::keccak_extract(this->context.state, this->context.data, 136);
+			this->context.size = 0;
+			this->context.squeezing = true;
+		}
+		inline std::string hashpp::SHA::SHAKE256::getHash(const std::string& data) {
+			this->reset();
+			this->update(data);
+			return this->hexDigest();
+		}
+		inline std::string hashpp::SHA::SHAKE256::getHash(const std::filesystem::path& path) {
+			std::ifstream file(path, std::ios::binary);
+			std::vector<char> buf(1024 * 1024, 0);
+
+			this->reset();
+			while (file) {
+				file.read(buf.data(), buf.size());
+				this->update(buf.data(), static_cast<size_t>(file.gcount()));
 			}
-			else {
-				PU128B(this->context.count[0], this->context.count[1],
-					last_padded_block,
-					128 - (2 * sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
+			return this->hexDigest();
+		}
+		inline std::string hashpp::SHA::SHAKE256::hexDigest() {
+			const char* digits = "0123456789abcdef";
+			uint8_t digest[64];
+			std::string hash(128, '0');
+
+			this->squeeze(digest, sizeof(digest));
+			for (uint32_t i = 0; i < 64; ++i) {
+				hash[i * 2] = digits[digest[i] >> 4];
+				hash[i * 2 + 1] = digits[digest[i] & 0x0F];
 			}
+			return hash;
+		}
+	}
 
-			PU64B(this->context.state[0], this->context.digest, 0);
-			PU64B(this->context.state[1], this->context.digest, 8);
-			PU64B(this->context.state[2], this->context.digest, 16);
-			PU64B(this->context.state[3], this->context.digest, 24);
-			PU64B(this->context.state[4], this->context.digest, 32);
-			PU64B(this->context.state[5], this->context.digest, 40);
+	// BLAKE hash family
+	namespace BLAKE {
+		// BLAKE2b-512 and BLAKE2s-256 (RFC 7693). getHMAC computes the keyed hash natively
+		// supported by BLAKE2 rather than the HMAC construction: keys of up to 64 (BLAKE2b) or
+		// 32 (BLAKE2s) bytes are used as is, and longer keys are replaced by their digest, as
+		// HMAC does with keys longer than its block
+		class BLAKE2b : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 64);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 128, DIGEST_SIZE = 64;
+
+			// chaining value, bytes compressed so far and the pending block; a whole pending
+			// block is kept until more input follows, as the final block is compressed
+			// differently from the others
+			typedef struct {
+				uint64_t state[8];
+				uint64_t count;
+				uint32_t size;
+				uint8_t  data[128], digest[64];
+			} CTX;
+
+			CTX context = { 0 };
+
+			inline void ctx_init() override;
+			inline void ctx_key(const std::string& key);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		class BLAKE2s : public common {
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 32);
+			}
+
+		private:
+			const uint8_t BLOCK_SIZE = 64, DIGEST_SIZE = 32;
+
+			// see BLAKE2b
+			typedef struct {
+				uint32_t state[8];
+				uint64_t count;
+				uint32_t size;
+				uint8_t  data[64], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			inline void ctx_init() override;
+			inline void ctx_key(const std::string& key);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_final() override;
+
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		// BLAKE3 (256-bit output), which hashes each 1 KiB chunk of its input independently and
+		// combines their chaining values in a binary tree. Chunks (and parents) are hashed
+		// across SIMD lanes, and inputs and files of several MiB are split across threads,
+		// each hashing whole 1 MiB subtrees. getHMAC computes BLAKE3's keyed hash rather than
+		// the HMAC construction: its 32-byte key is the given key padded with zeros, or the
+		// digest of keys longer than 32 bytes
+		class BLAKE3 : public common {
+		public:
+			// get hexadecimal hash from data, or from file, splitting large ones across threads
+			inline std::string getHash(const std::string& data);
+			inline std::string getHash(const std::filesystem::path& path);
+
+		protected:
+			std::vector<uint8_t> getBytes() override {
+				return std::vector<uint8_t>(context.digest, context.digest + 32);
+			}
+
+		private:
+			const uint8_t DIGEST_SIZE = 32;
+
+			// size of the subtrees hashed by each thread, in bytes
+			static constexpr size_t SUBTREE = 1024 * 1024;
+
+			// key words and flags, whole chunks hashed so far, the pending chunk (kept until
+			// more input follows, as the last chunk may be the root) and the stack of chaining
+			// values of completed subtrees, still to be merged into their parents
+			typedef struct {
+				uint32_t key[8], flags;
+				uint64_t chunks;
+				uint32_t size, depth;
+				uint8_t  data[1024], stack[54 * 32], digest[32];
+			} CTX;
+
+			CTX context = { 0 };
+
+			inline void ctx_init() override;
+			inline void ctx_key(const std::string& key);
+			inline void ctx_merge();
+			inline void ctx_push(const uint8_t cv[32], uint64_t chunks);
+			inline void ctx_update(const uint8_t* data, size_t len) override;
+			inline void ctx_subtrees(const uint8_t* data, size_t len);
+			inline void ctx_final() override;
+
+			inline std::string hexDigest();
+			inline std::string _H(const std::string& a, const std::string& b) override;
+			inline std::string HMAC(const std::string& key, const std::string& data) override;
+		};
+
+		// BLAKE2b
+		inline void hashpp::BLAKE::BLAKE2b::ctx_init() {
+			this->context = { {0}, 0, 0 };
+			for (uint32_t i = 0; i < 8; ++i) {
+				this->context.state[i] = hashpp::simd::SHA512_H[i];
+			}
+
+			// parameter block: digest length, no key, fanout and depth of 1
+			this->context.state[0] ^= 0x01010000 ^ this->DIGEST_SIZE;
 		}
-		inline std::string SHA2_384::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+		inline void hashpp::BLAKE::BLAKE2b::ctx_key(const std::string& key) {
+			// the key length joins the parameter block, and the key, padded with zeros,
+			// is the first block of input
+			this->context.state[0] ^= static_cast<uint64_t>(key.length()) << 8;
+			if (!key.empty()) {
+				memset(this->context.data, 0, this->BLOCK_SIZE);
+				memcpy(this->context.data, key.data(), key.length());
+				this->context.size = this->BLOCK_SIZE;
+			}
 		}
-		inline std::string SHA2_384::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[128] = {0};
+		inline void hashpp::BLAKE::BLAKE2b::ctx_update(const uint8_t* data, size_t len) {
+			if (len == 0) {
+				return;
+			}
+
+			// complete the pending block, compressing it only if more input follows
+			if (this->context.size != 0) {
+				size_t fill = 128 - this->context.size;
+				if (len <= fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				hashpp::simd::blake2b_blocks(this->context.state, this->context.data, 1, this->context.count, false);
+				this->context.count += 128;
+				data += fill;
+				len -= fill;
+			}
+
+			// all but the last block are compressed straight from the input, in one run so
+			// that the state stays in registers between them
+			if (len > 128) {
+				size_t blocks = (len - 1) / 128;
+				hashpp::simd::blake2b_blocks(this->context.state, data, blocks, this->context.count, false);
+				this->context.count += blocks * 128;
+				data += blocks * 128;
+				len -= blocks * 128;
+			}
+
+			memcpy(this->context.data, data, len);
+			this->context.size = static_cast<uint32_t>(len);
+		}
+		inline void hashpp::BLAKE::BLAKE2b::ctx_final() {
+			const uint32_t L = this->context.size;
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
-				}
+			// the final block is padded with zeros, its counter covering only the message
+			// bytes it holds
+			memset(this->context.data + L, 0, 128 - L);
+			hashpp::simd::blake2b_blocks(this->context.state, this->context.data, 1, this->context.count + L - 128, true);
+
+			for (uint32_t i = 0; i < 64; ++i) {
+				this->context.digest[i] = static_cast<uint8_t>(this->context.state[i / 8] >> (8 * (i % 8)));
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
-				}
+		}
+		inline std::string hashpp::BLAKE::BLAKE2b::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string hashpp::BLAKE::BLAKE2b::HMAC(const std::string& key, const std::string& data) {
+			std::string k = key;
+			if (k.length() > this->DIGEST_SIZE) {
+				const std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				k.assign(k_.begin(), k_.end());
 			}
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
+			this->ctx_init();
+			this->ctx_key(k);
+			this->ctx_update(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+			this->ctx_final();
+
+			std::string hash;
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				hash += this->hexTable[this->context.digest[i]];
 			}
+			return hash;
+		}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
+		// BLAKE2s
+		inline void hashpp::BLAKE::BLAKE2s::ctx_init() {
+			this->context = { {0}, 0, 0 };
+			for (uint32_t i = 0; i < 8; ++i) {
+				this->context.state[i] = hashpp::simd::SHA256_H[i];
 			}
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+			// parameter block: digest length, no key, fanout and depth of 1
+			this->context.state[0] ^= 0x01010000 ^ this->DIGEST_SIZE;
+		}
+		inline void hashpp::BLAKE::BLAKE2s::ctx_key(const std::string& key) {
+			// the key length joins the parameter block, and the key, padded with zeros,
+			// is the first block of input
+			this->context.state[0] ^= static_cast<uint32_t>(key.length()) << 8;
+			if (!key.empty()) {
+				memset(this->context.data, 0, this->BLOCK_SIZE);
+				memcpy(this->context.data, key.data(), key.length());
+				this->context.size = this->BLOCK_SIZE;
+			}
+		}
+		inline void hashpp::BLAKE::BLAKE2s::ctx_update(const uint8_t* data, size_t len) {
+			if (len == 0) {
+				return;
+			}
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
+			// complete the pending block, compressing it only if more input follows
+			if (this->context.size != 0) {
+				size_t fill = 64 - this->context.size;
+				if (len <= fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
+				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				hashpp::simd::blake2s_blocks(this->context.state, this->context.data, 1, this->context.count, false);
+				this->context.count += 64;
+				data += fill;
+				len -= fill;
 			}
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+			// all but the last block are compressed straight from the input
+			if (len > 64) {
+				size_t blocks = (len - 1) / 64;
+				hashpp::simd::blake2s_blocks(this->context.state, data, blocks, this->context.count, false);
+				this->context.count += blocks * 64;
+				data += blocks * 64;
+				len -= blocks * 64;
 			}
 
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+			memcpy(this->context.data, data, len);
+			this->context.size = static_cast<uint32_t>(len);
 		}
-		constexpr uint64_t hashpp::SHA::SHA2_384::F(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (~A & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_384::G(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (A & C) ^ (B & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_384::SIGMA0(const uint64_t A) { return this->rr64(A, 28) ^ this->rr64(A, 34) ^ this->rr64(A, 39); }
-		constexpr uint64_t hashpp::SHA::SHA2_384::SIGMA1(const uint64_t A) { return this->rr64(A, 14) ^ this->rr64(A, 18) ^ this->rr64(A, 41); }
-		constexpr uint64_t hashpp::SHA::SHA2_384::SIGMA2(const uint64_t A) { return this->rr64(A, 1) ^ this->rr64(A, 8) ^ (A >> 7); }
-		constexpr uint64_t hashpp::SHA::SHA2_384::SIGMA3(const uint64_t A) { return this->rr64(A, 19) ^ this->rr64(A, 61) ^ (A >> 6); }
+		inline void hashpp::BLAKE::BLAKE2s::ctx_final() {
+			const uint32_t L = this->context.size;
 
-		// SHA2-512
-		inline void hashpp::SHA::SHA2_512::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				{0, 0}
-			};
-		}
-		void hashpp::SHA::SHA2_512::ctx_transform(const uint8_t* data) {
-			uint64_t W[80];
-			uint32_t i;
-
-			uint64_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
+			memset(this->context.data + L, 0, 64 - L);
+			hashpp::simd::blake2s_blocks(this->context.state, this->context.data, 1, this->context.count + L - 64, true);
 
-			for (i = 0; i < 16; i++) {
-				GU64B(W[i], data, 8 * i);
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (i = 16; i < 80; i++) {
-				W[i] = this->SIGMA3(W[i - 2]) + W[i - 7] + this->SIGMA2(W[i - 15]) + W[i - 16];
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
+			for (uint32_t i = 0; i < 32; ++i) {
+				this->context.digest[i] = static_cast<uint8_t>(this->context.state[i / 4] >> (8 * (i % 4)));
 			}
 		}
-		inline void hashpp::SHA::SHA2_512::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t left, fill, rlen = len;
-			const uint8_t* ptr = data;
+		inline std::string hashpp::BLAKE::BLAKE2s::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
+		}
+		inline std::string hashpp::BLAKE::BLAKE2s::HMAC(const std::string& key, const std::string& data) {
+			std::string k = key;
+			if (k.length() > this->DIGEST_SIZE) {
+				const std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				k.assign(k_.begin(), k_.end());
+			}
 
-			if (len != 0) {
+			this->ctx_init();
+			this->ctx_key(k);
+			this->ctx_update(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+			this->ctx_final();
 
-				left = this->context.count[0] & 0x7F; fill = 128 - left;
+			std::string hash;
+			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
+				hash += this->hexTable[this->context.digest[i]];
+			}
+			return hash;
+		}
 
-				this->context.count[0] += len;
-				if ((this->context.count[0]) < (len)) {
-					(this->context.count[1])++;
-				}
+		// BLAKE3
+		inline std::string hashpp::BLAKE::BLAKE3::getHash(const std::string& data) {
+			this->ctx_init();
+			this->ctx_subtrees(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+			this->ctx_final();
 
-				if ((left > 0) && (rlen >= fill)) {
-					memcpy(this->context.data + left, ptr, fill);
-					this->ctx_transform(this->context.data);
-					ptr += fill;
-					rlen -= fill;
-					left = 0;
-				}
+			return this->hexDigest();
+		}
+		inline std::string hashpp::BLAKE::BLAKE3::getHash(const std::filesystem::path& path) {
+			std::error_code ec;
+			const uintmax_t length = std::filesystem::file_size(path, ec);
+			const size_t subtrees = !ec && length > 2 * SUBTREE ? static_cast<size_t>((length - 1) / SUBTREE) : 0;
 
-				while (rlen >= 128) {
-					this->ctx_transform(ptr);
-					ptr += 128;
-					rlen -= 128;
-				}
+			this->ctx_init();
 
-				if (rlen > 0) {
-					memcpy(this->context.data + left, ptr, rlen);
+			// whole subtrees followed by more of the file are hashed across threads, each
+			// reading its own run of them; should any read come up short, the file is
+			// hashed from the start on this thread instead
+			size_t offset = 0;
+			if (subtrees != 0) {
+				std::vector<uint8_t> cvs(subtrees * 32);
+				std::atomic<bool> failed(false);
+				hashpp::simd::parallel(subtrees, 1, [&](size_t begin, size_t end) {
+					std::ifstream file(path, std::ios::binary);
+					std::vector<char> buf(SUBTREE, 0);
+
+					file.seekg(static_cast<std::streamoff>(begin * SUBTREE));
+					for (size_t i = begin; i < end && !failed; ++i) {
+						file.read(buf.data(), buf.size());
+						if (file.fail() || static_cast<size_t>(file.gcount()) != buf.size()) {
+							failed = true;
+							return;
+						}
+						hashpp::simd::blake3_subtree(reinterpret_cast<const uint8_t*>(buf.data()), SUBTREE / 1024,
+							this->context.key, i * (SUBTREE / 1024), this->context.flags, &cvs[i * 32]);
+					}
+				});
+
+				if (!failed) {
+					for (size_t i = 0; i < subtrees; ++i) {
+						this->ctx_push(&cvs[i * 32], SUBTREE / 1024);
+					}
+					offset = subtrees * SUBTREE;
 				}
 			}
-		}
-		inline void hashpp::SHA::SHA2_512::ctx_final() {
-			uint32_t block_present = 0;
-			uint8_t last_padded_block[2 * 128];
 
-			memset(last_padded_block, 0, sizeof(last_padded_block));
+			// then the rest of the file, as common::getHash would
+			std::ifstream file(path, std::ios::binary);
+			std::vector<char> buf(SUBTREE, 0);
 
-			block_present = this->context.count[0] % 128;
-			if (block_present != 0) {
-				memcpy(last_padded_block, this->context.data, block_present);
+			file.seekg(static_cast<std::streamoff>(offset));
+			while (file) {
+				file.read(buf.data(), buf.size());
+				this->ctx_update(reinterpret_cast<uint8_t*>(buf.data()), file.gcount());
 			}
+			this->ctx_final();
 
-			last_padded_block[block_present] = 0x80;
-
-			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
-				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
-				this->ctx_transform(last_padded_block + 128);
+			return this->hexDigest();
+		}
+		inline void hashpp::BLAKE::BLAKE3::ctx_init() {
+			this->context = { {0}, 0, 0, 0, 0 };
+			for (uint32_t i = 0; i < 8; ++i) {
+				this->context.key[i] = hashpp::simd::SHA256_H[i];
 			}
-			else {
-				PU128B(this->context.count[0], this->context.count[1],
-					last_padded_block,
-					128 - (2 * sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
+		}
+		inline void hashpp::BLAKE::BLAKE3::ctx_key(const std::string& key) {
+			// the key (at most 32 bytes here), padded with zeros, replaces the initial values
+			uint8_t k[32] = { 0 };
+			memcpy(k, key.data(), key.length());
+			for (uint32_t i = 0; i < 8; ++i) {
+				this->context.key[i] = hashpp::simd::blake2_word<uint32_t>(k + i * 4);
+			}
+			this->context.flags = hashpp::simd::BLAKE3_KEYED_HASH;
+		}
+		inline void hashpp::BLAKE::BLAKE3::ctx_merge() {
+			// once more input follows them, the completed subtrees are merged into their parents
+			// down to one per bit set in the count of chunks hashed
+			uint32_t bits = 0;
+			for (uint64_t c = this->context.chunks; c != 0; c &= c - 1) {
+				++bits;
+			}
+			for (; this->context.depth > bits; --this->context.depth) {
+				uint8_t* children = this->context.stack + (this->context.depth - 2) * 32;
+				hashpp::simd::blake3_parent(children, this->context.key, this->context.flags, false, children);
 			}
-
-			PU64B(this->context.state[0], this->context.digest, 0);
-			PU64B(this->context.state[1], this->context.digest, 8);
-			PU64B(this->context.state[2], this->context.digest, 16);
-			PU64B(this->context.state[3], this->context.digest, 24);
-			PU64B(this->context.state[4], this->context.digest, 32);
-			PU64B(this->context.state[5], this->context.digest, 40);
-			PU64B(this->context.state[6], this->context.digest, 48);
-			PU64B(this->context.state[7], this->context.digest, 56);
 		}
-		inline std::string SHA2_512::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+		inline void hashpp::BLAKE::BLAKE3::ctx_push(const uint8_t cv[32], uint64_t chunks) {
+			this->ctx_merge();
+			memcpy(this->context.stack + this->context.depth * 32, cv, 32);
+			++this->context.depth;
+			this->context.chunks += chunks;
 		}
-		inline std::string SHA2_512::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[128] = {0};
-
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
-				}
+		inline void hashpp::BLAKE::BLAKE3::ctx_update(const uint8_t* data, size_t len) {
+			uint8_t cv[32];
+			if (len == 0) {
+				return;
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
+
+			// complete the pending chunk, hashing it only if more input follows
+			if (this->context.size != 0) {
+				size_t fill = 1024 - this->context.size;
+				if (len <= fill) {
+					memcpy(this->context.data + this->context.size, data, len);
+					this->context.size += static_cast<uint32_t>(len);
+					return;
 				}
+				memcpy(this->context.data + this->context.size, data, fill);
+				hashpp::simd::blake3_chunk(this->context.data, 1024, this->context.key, this->context.chunks,
+					this->context.flags, false, cv);
+				this->ctx_push(cv, 1);
+				data += fill;
+				len -= fill;
 			}
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
-			}
+			// whole subtrees straight from the input, each the largest power of two chunks
+			// that leaves input over and is aligned to its size in the message
+			while (len > 1024) {
+				uint64_t chunks = 1;
+				while (chunks * 2 <= (len - 1) / 1024) {
+					chunks *= 2;
+				}
+				while ((this->context.chunks & (chunks - 1)) != 0) {
+					chunks /= 2;
+				}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
+				hashpp::simd::blake3_subtree(data, static_cast<size_t>(chunks), this->context.key, this->context.chunks,
+					this->context.flags, cv);
+				this->ctx_push(cv, chunks);
+				data += chunks * 1024;
+				len -= chunks * 1024;
 			}
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+			memcpy(this->context.data, data, len);
+			this->context.size = static_cast<uint32_t>(len);
+			this->ctx_merge();
+		}
+		inline void hashpp::BLAKE::BLAKE3::ctx_subtrees(const uint8_t* data, size_t len) {
+			// at the start of a message, whole subtrees followed by more input are hashed across
+			// threads first
+			const size_t subtrees = this->context.chunks == 0 && this->context.size == 0 && len > 2 * SUBTREE ?
+				(len - 1) / SUBTREE : 0;
+
+			if (subtrees != 0) {
+				std::vector<uint8_t> cvs(subtrees * 32);
+				hashpp::simd::parallel(subtrees, 1, [&](size_t begin, size_t end) {
+					for (size_t i = begin; i < end; ++i) {
+						hashpp::simd::blake3_subtree(data + i * SUBTREE, SUBTREE / 1024, this->context.key,
+							i * (SUBTREE / 1024), this->context.flags, &cvs[i * 32]);
+					}
+				});
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
+				for (size_t i = 0; i < subtrees; ++i) {
+					this->ctx_push(&cvs[i * 32], SUBTREE / 1024);
+				}
+				data += subtrees * SUBTREE;
+				len -= subtrees * SUBTREE;
 			}
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
+			this->ctx_update(data, len);
+		}
+		inline void hashpp::BLAKE::BLAKE3::ctx_final() {
+			uint8_t cv[32];
+
+			// a message of one chunk is its own root; otherwise the last chunk is merged with
+			// the stacked subtrees from the top down, the last parent being the root
+			if (this->context.depth == 0) {
+				hashpp::simd::blake3_chunk(this->context.data, this->context.size, this->context.key, this->context.chunks,
+					this->context.flags, true, this->context.digest);
+				return;
+			}
+
+			hashpp::simd::blake3_chunk(this->context.data, this->context.size, this->context.key, this->context.chunks,
+				this->context.flags, false, cv);
+			for (; this->context.depth != 0; --this->context.depth) {
+				uint8_t children[64];
+				memcpy(children, this->context.stack + (this->context.depth - 1) * 32, 32);
+				memcpy(children + 32, cv, 32);
+				hashpp::simd::blake3_parent(children, this->context.key, this->context.flags, this->context.depth == 1, cv);
+			}
+			memcpy(this->context.digest, cv, 32);
+		}
+		inline std::string hashpp::BLAKE::BLAKE3::hexDigest() {
+			std::string hash;
 			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+				hash += this->hexTable[this->context.digest[i]];
 			}
-
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+			return hash;
 		}
-		constexpr uint64_t hashpp::SHA::SHA2_512::F(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (~A & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512::G(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (A & C) ^ (B & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512::SIGMA0(const uint64_t A) { return this->rr64(A, 28) ^ this->rr64(A, 34) ^ this->rr64(A, 39); }
-		constexpr uint64_t hashpp::SHA::SHA2_512::SIGMA1(const uint64_t A) { return this->rr64(A, 14) ^ this->rr64(A, 18) ^ this->rr64(A, 41); }
-		constexpr uint64_t hashpp::SHA::SHA2_512::SIGMA2(const uint64_t A) { return this->rr64(A, 1) ^ this->rr64(A, 8) ^ (A >> 7); }
-		constexpr uint64_t hashpp::SHA::SHA2_512::SIGMA3(const uint64_t A) { return this->rr64(A, 19) ^ this->rr64(A, 61) ^ (A >> 6); }
-
-		// SHA2-512-224
-		inline void hashpp::SHA::SHA2_512_224::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				{0, 0}
-			};
+		inline std::string hashpp::BLAKE::BLAKE3::_H(const std::string& a, const std::string& b) {
+			return this->getHash(a + b);
 		}
-		inline void hashpp::SHA::SHA2_512_224::ctx_transform(const uint8_t* data) {
-			uint64_t W[80];
-			uint32_t i;
-
-			uint64_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
-
-			for (i = 0; i < 16; i++) {
-				GU64B(W[i], data, 8 * i);
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (i = 16; i < 80; i++) {
-				W[i] = this->SIGMA3(W[i - 2]) + W[i - 7] + this->SIGMA2(W[i - 15]) + W[i - 16];
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
+		inline std::string hashpp::BLAKE::BLAKE3::HMAC(const std::string& key, const std::string& data) {
+			std::string k = key;
+			if (k.length() > this->DIGEST_SIZE) {
+				const std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
+				k.assign(k_.begin(), k_.end());
 			}
+
+			this->ctx_init();
+			this->ctx_key(k);
+			this->ctx_subtrees(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+			this->ctx_final();
+
+			return this->hexDigest();
 		}
-		inline void hashpp::SHA::SHA2_512_224::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t left, fill, rlen = len;
-			const uint8_t* ptr = data;
+	}
 
-			if (len != 0) {
 
-				left = this->context.count[0] & 0x7F; fill = 128 - left;
+	// class used by the getHashes/getHMACs interfaces to hash many messages
+	// with a single algorithm, spreading them across SIMD lanes when the host
+	// processor supports it and otherwise reusing one algorithm instance
+	class batch {
+	public:
+		// hashes each string in 'data' with algorithm class _Ty, appending the
+		// hexadecimal digests to 'out' in the same order
+		template <class _Ty>
+		static void appendHashes(const std::vector<std::string>& data, std::vector<std::string>& out,
+			hashpp::ENCODINGS encoding = hashpp::ENCODINGS::BYTES) {
+			const bool utf16 = encoding == hashpp::ENCODINGS::UTF16LE;
 
-				this->context.count[0] += len;
-				if ((this->context.count[0]) < (len)) {
-					(this->context.count[1])++;
+			if constexpr (std::is_same_v<_Ty, hashpp::MD::MD5>) {
+				if (md5(data, out, initialValues<_Ty>(), digestSize<_Ty>(), 0, true, utf16)) {
+					return;
 				}
-
-				if ((left > 0) && (rlen >= fill)) {
-					memcpy(this->context.data + left, ptr, fill);
-					this->ctx_transform(this->context.data);
-					ptr += fill;
-					rlen -= fill;
-					left = 0;
+			}
+			else if constexpr (std::is_same_v<_Ty, hashpp::MD::MD4>) {
+				if (md4(data, out, initialValues<_Ty>(), digestSize<_Ty>(), 0, true, utf16)) {
+					return;
 				}
-
-				while (rlen >= 128) {
-					this->ctx_transform(ptr);
-					ptr += 128;
-					rlen -= 128;
+			}
+			else if constexpr (std::is_same_v<_Ty, hashpp::MD::MD2>) {
+				if (md2(data, out, utf16)) {
+					return;
+				}
+			}
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA1>) {
+				if (sha1(data, out, initialValues<_Ty>(), digestSize<_Ty>(), 0, true, utf16)) {
+					return;
+				}
+			}
+			else if constexpr (isSHA256<_Ty>()) {
+				if (sha256(data, out, initialValues<_Ty>(), digestSize<_Ty>(), 0, true, utf16)) {
+					return;
+				}
+			}
+			else if constexpr (isSHA512<_Ty>()) {
+				if (sha512(data, out, initialValues<_Ty>(), digestSize<_Ty>(), 0, true, utf16)) {
+					return;
+				}
+			}
+			else if constexpr (isKeccak<_Ty>()) {
+				if (keccak(data, out, rate<_Ty>(), suffix<_Ty>(), digestSize<_Ty>(), utf16)) {
+					return;
 				}
+			}
 
-				if (rlen > 0) {
-					memcpy(this->context.data + left, ptr, rlen);
+			_Ty algorithm;
+			if (utf16) {
+				// without a multi-buffer kernel, each widened message
+				// is staged in one reused buffer
+				hashpp::simd::utf16le reader;
+				std::string wide;
+				for (const std::string& d : data) {
+					wide.resize(hashpp::simd::utf16le::length(d));
+					reader.reset(d);
+					reader.read(reinterpret_cast<uint8_t*>(&wide[0]), wide.length());
+					out.push_back(algorithm.getHash(wide));
 				}
+				return;
+			}
+			for (const std::string& d : data) {
+				out.push_back(algorithm.getHash(d));
 			}
 		}
-		inline void hashpp::SHA::SHA2_512_224::ctx_final() {
-			uint32_t block_present = 0;
-			uint8_t last_padded_block[2 * 128];
 
-			memset(last_padded_block, 0, sizeof(last_padded_block));
-
-			block_present = this->context.count[0] % 128;
-			if (block_present != 0) {
-				memcpy(last_padded_block, this->context.data, block_present);
-			}
+		// hashes each file in 'paths' with algorithm class _Ty, appending the hexadecimal
+		// digests to 'out' in the same order; runs of small files are read into memory and
+		// hashed together through appendHashes, while larger files are streamed one at a time
+		template <class _Ty>
+		static void appendFileHashes(const std::vector<std::filesystem::path>& paths, std::vector<std::string>& out) {
+			constexpr uintmax_t fileLimit = 1024 * 1024, batchLimit = 16 * 1024 * 1024;
+			std::vector<std::string> pending;
+			uintmax_t pendingSize = 0;
+
+			for (const std::filesystem::path& path : paths) {
+				std::error_code ec;
+				const uintmax_t size = std::filesystem::file_size(path, ec);
+				if (ec || size > fileLimit) {
+					appendHashes<_Ty>(pending, out);
+					pending.clear();
+					pendingSize = 0;
+					out.push_back(_Ty().getHash(path));
+					continue;
+				}
 
-			last_padded_block[block_present] = 0x80;
+				std::ifstream file(path, std::ios::binary);
+				std::string contents(static_cast<size_t>(size), '\0');
+				file.read(&contents[0], static_cast<std::streamsize>(size));
+				contents.resize(static_cast<size_t>(file.gcount()));
+				pendingSize += contents.length();
+				pending.push_back(std::move(contents));
 
-			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
-				/* We need an additional block */
-				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
-				this->ctx_transform(last_padded_block + 128);
-			}
-			else {
-				PU128B(this->context.count[0], this->context.count[1],
-					last_padded_block,
-					128 - (2 * sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
+				if (pendingSize >= batchLimit) {
+					appendHashes<_Ty>(pending, out);
+					pending.clear();
+					pendingSize = 0;
+				}
 			}
-
-			PU64B(this->context.state[0], this->context.digest, 0);
-			PU64B(this->context.state[1], this->context.digest, 8);
-			PU64B(this->context.state[2], this->context.digest, 16);
-			PU64B(this->context.state[3], this->context.digest, 24);
-		}
-		inline std::string SHA2_512_224::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+			appendHashes<_Ty>(pending, out);
 		}
-		inline std::string SHA2_512_224::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[128] = {0};
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
+		// computes the HMAC of each string in 'data' under 'key' with algorithm class
+		// _Ty, appending the hexadecimal digests to 'out' in the same order
+		template <class _Ty>
+		static void appendHMACs(const std::string& key, const std::vector<std::string>& data, std::vector<std::string>& out) {
+			if constexpr (std::is_same_v<_Ty, hashpp::MD::MD5>) {
+				if (hmac<hashpp::simd::md5_traits>(key, data, out, initialValues<_Ty>(), digestSize<_Ty>(),
+					hashpp::simd::md5_blocks, md5)) {
+					return;
+				}
+			}
+			else if constexpr (std::is_same_v<_Ty, hashpp::MD::MD4>) {
+				if (hmac<hashpp::simd::md4_traits>(key, data, out, initialValues<_Ty>(), digestSize<_Ty>(),
+					hashpp::simd::md4_blocks, md4)) {
+					return;
 				}
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA1>) {
+				if (hmac<hashpp::simd::sha1_traits>(key, data, out, initialValues<_Ty>(), digestSize<_Ty>(),
+					hashpp::simd::sha1_blocks, sha1)) {
+					return;
+				}
+			}
+			else if constexpr (isSHA256<_Ty>()) {
+				if (hmac<hashpp::simd::sha256_traits>(key, data, out, initialValues<_Ty>(), digestSize<_Ty>(),
+					hashpp::simd::sha256_blocks, sha256)) {
+					return;
+				}
+			}
+			else if constexpr (isSHA512<_Ty>()) {
+				if (hmac<hashpp::simd::sha512_traits>(key, data, out, initialValues<_Ty>(), digestSize<_Ty>(),
+					hashpp::simd::sha512_blocks, sha512)) {
+					return;
 				}
 			}
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
+			// computing an HMAC consumes the algorithm object's pads,
+			// so each message gets a fresh instance
+			for (const std::string& d : data) {
+				out.push_back(_Ty().getHMAC(key, d));
 			}
+		}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
+		// hashes 'data' on the stack if it fits in two blocks with its padding (or, for
+		// SHA-3 and BLAKE2, at any length), writing the hexadecimal digest to 'out'; returns false
+		// for longer messages and MD2
+		static bool shortHash(hashpp::ALGORITHMS algorithm, const std::string& data, std::string& out) {
+			switch (algorithm) {
+			case hashpp::ALGORITHMS::MD5:
+				return shortHash<hashpp::simd::md5_traits, hashpp::MD::MD5>(data, out, hashpp::simd::md5_blocks);
+			case hashpp::ALGORITHMS::MD4:
+				return shortHash<hashpp::simd::md5_traits, hashpp::MD::MD4>(data, out, hashpp::simd::md4_blocks);
+			case hashpp::ALGORITHMS::SHA1:
+				return shortHash<hashpp::simd::sha1_traits, hashpp::SHA::SHA1>(data, out, hashpp::simd::sha1_blocks);
+			case hashpp::ALGORITHMS::SHA2_224:
+				return shortHash<hashpp::simd::sha256_traits, hashpp::SHA::SHA2_224>(data, out, hashpp::simd::sha256_blocks);
+			case hashpp::ALGORITHMS::SHA2_256:
+				return shortHash<hashpp::simd::sha256_traits, hashpp::SHA::SHA2_256>(data, out, hashpp::simd::sha256_blocks);
+			case hashpp::ALGORITHMS::SHA2_384:
+				return shortHash<hashpp::simd::sha512_traits, hashpp::SHA::SHA2_384>(data, out, hashpp::simd::sha512_blocks);
+			case hashpp::ALGORITHMS::SHA2_512:
+				return shortHash<hashpp::simd::sha512_traits, hashpp::SHA::SHA2_512>(data, out, hashpp::simd::sha512_blocks);
+			case hashpp::ALGORITHMS::SHA2_512_224:
+				return shortHash<hashpp::simd::sha512_traits, hashpp::SHA::SHA2_512_224>(data, out, hashpp::simd::sha512_blocks);
+			case hashpp::ALGORITHMS::SHA2_512_256:
+				return shortHash<hashpp::simd::sha512_traits, hashpp::SHA::SHA2_512_256>(data, out, hashpp::simd::sha512_blocks);
+			case hashpp::ALGORITHMS::SHA3_224:
+				return sha3<144>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::SHA3_256:
+				return sha3<136>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::SHA3_384:
+				return sha3<104>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::SHA3_512:
+				return sha3<72>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::SHAKE128:
+				return sha3<168, 0x1F, 32>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::SHAKE256:
+				return sha3<136, 0x1F, 64>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::BLAKE2B:
+				return blake2<uint64_t>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			case hashpp::ALGORITHMS::BLAKE2S:
+				return blake2<uint32_t>(reinterpret_cast<const uint8_t*>(data.data()), data.length(), out);
+			default:
+				return false;
 			}
+		}
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+		// hashes the _N bytes at 'data' with the padding built at compile time, writing the
+		// hexadecimal digest to 'out'; a last block holding only padding is compressed from
+		// its precomputed message schedule where the portable rounds beat the bound kernel
+		template <hashpp::ALGORITHMS _Algorithm, size_t _N>
+		static void fixedHash(const uint8_t* data, std::string& out) {
+			using namespace hashpp::simd;
+			const bool generic256 = bound().sha256.transform == sha256_generic;
+			const bool generic512 = sizeof(void*) == 8 || bound().sha512.transform == sha512_generic;
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
+			if constexpr (_Algorithm == hashpp::ALGORITHMS::MD5) {
+				fixedHash<md5_traits, hashpp::MD::MD5, _N>(data, out, md5_blocks, nullptr);
 			}
-
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::MD4) {
+				fixedHash<md5_traits, hashpp::MD::MD4, _N>(data, out, md4_blocks, nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA1) {
+				fixedHash<sha1_traits, hashpp::SHA::SHA1, _N, 80, sha1_schedule>(data, out, sha1_blocks,
+					bound().sha1.transform == sha1_generic ? sha1_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_224) {
+				fixedHash<sha256_traits, hashpp::SHA::SHA2_224, _N, 64, sha256_schedule>(data, out, sha256_blocks,
+					generic256 ? sha256_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_256) {
+				fixedHash<sha256_traits, hashpp::SHA::SHA2_256, _N, 64, sha256_schedule>(data, out, sha256_blocks,
+					generic256 ? sha256_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_384) {
+				fixedHash<sha512_traits, hashpp::SHA::SHA2_384, _N, 80, sha512_schedule>(data, out, sha512_blocks,
+					generic512 ? sha512_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_512) {
+				fixedHash<sha512_traits, hashpp::SHA::SHA2_512, _N, 80, sha512_schedule>(data, out, sha512_blocks,
+					generic512 ? sha512_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_512_224) {
+				fixedHash<sha512_traits, hashpp::SHA::SHA2_512_224, _N, 80, sha512_schedule>(data, out, sha512_blocks,
+					generic512 ? sha512_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA2_512_256) {
+				fixedHash<sha512_traits, hashpp::SHA::SHA2_512_256, _N, 80, sha512_schedule>(data, out, sha512_blocks,
+					generic512 ? sha512_rounds : nullptr);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA3_224) {
+				sha3<144>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA3_256) {
+				sha3<136>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA3_384) {
+				sha3<104>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHA3_512) {
+				sha3<72>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHAKE128) {
+				sha3<168, 0x1F, 32>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::SHAKE256) {
+				sha3<136, 0x1F, 64>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::BLAKE2B) {
+				blake2<uint64_t>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::BLAKE2S) {
+				blake2<uint32_t>(data, _N, out);
+			}
+			else if constexpr (_Algorithm == hashpp::ALGORITHMS::BLAKE3) {
+				out = hashpp::BLAKE::BLAKE3().getHash(std::string(reinterpret_cast<const char*>(data), _N));
+			}
+			else {
+				// MD2 pads with a checksum rather than the message length
+				out = hashpp::MD::MD2().getHash(std::string(reinterpret_cast<const char*>(data), _N));
 			}
-
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
 		}
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::F(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (~A & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::G(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (A & C) ^ (B & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::SIGMA0(const uint64_t A) { return this->rr64(A, 28) ^ this->rr64(A, 34) ^ this->rr64(A, 39); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::SIGMA1(const uint64_t A) { return this->rr64(A, 14) ^ this->rr64(A, 18) ^ this->rr64(A, 41); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::SIGMA2(const uint64_t A) { return this->rr64(A, 1) ^ this->rr64(A, 8) ^ (A >> 7); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_224::SIGMA3(const uint64_t A) { return this->rr64(A, 19) ^ this->rr64(A, 61) ^ (A >> 6); }
 
-		// SHA2-512-256
-		inline void hashpp::SHA::SHA2_512_256::ctx_init() {
-			this->context = {
-				{this->H[0], this->H[1], this->H[2], this->H[3],
-					this->H[4], this->H[5], this->H[6], this->H[7]},
-				{0, 0}
-			};
+	private:
+		template <class _Traits, class _Ty, size_t _N, size_t _W = 1,
+			void (*_Schedule)(typename _Traits::word*, const uint8_t*) = nullptr>
+		static void fixedHash(const uint8_t* data, std::string& out,
+			void (*single)(typename _Traits::word*, const uint8_t*, size_t),
+			void (*rounds)(typename _Traits::word*, const typename _Traits::word*)) {
+			out.resize(digestSize<_Ty>() * 2);
+			hashpp::simd::fixed<_Traits, _N, _W, _Schedule>(initialValues<_Ty>(), digestSize<_Ty>(), single, rounds, data, &out[0]);
 		}
-		inline void hashpp::SHA::SHA2_512_256::ctx_transform(const uint8_t* data) {
-			uint64_t W[80];
-			uint32_t i;
-
-			uint64_t results[8] = {
-				this->context.state[0],
-				this->context.state[1],
-				this->context.state[2],
-				this->context.state[3],
-				this->context.state[4],
-				this->context.state[5],
-				this->context.state[6],
-				this->context.state[7]
-			};
 
-			for (i = 0; i < 16; i++) {
-				GU64B(W[i], data, 8 * i);
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (i = 16; i < 80; i++) {
-				W[i] = this->SIGMA3(W[i - 2]) + W[i - 7] + this->SIGMA2(W[i - 15]) + W[i - 16];
-				uint64_t t1, t2;
-				t1 = (results[7]) + this->SIGMA1((results[4])) + this->F((results[4]), (results[5]), (results[6])) + (this->K[i]) + (W[i]);
-				t2 = this->SIGMA0((results[0])) + this->G((results[0]), (results[1]), (results[2]));
-				(results[7]) = (results[6]);
-				(results[6]) = (results[5]);
-				(results[5]) = (results[4]);
-				(results[4]) = (results[3]) + t1;
-				(results[3]) = (results[2]);
-				(results[2]) = (results[1]);
-				(results[1]) = (results[0]);
-				(results[0]) = t1 + t2;
-			}
-
-			for (uint32_t z = 0; z < 8; z++) {
-				this->context.state[z] += results[z];
+		template <class _Traits, class _Ty>
+		static bool shortHash(const std::string& data, std::string& out,
+			void (*single)(typename _Traits::word*, const uint8_t*, size_t)) {
+			if (data.length() > 2 * _Traits::BLOCK - _Traits::LENGTH - 1) {
+				return false;
 			}
+			out.resize(digestSize<_Ty>() * 2);
+			hashpp::simd::oneshot<_Traits>(initialValues<_Ty>(), digestSize<_Ty>(), single,
+				reinterpret_cast<const uint8_t*>(data.data()), data.length(), &out[0]);
+			return true;
 		}
-		inline void hashpp::SHA::SHA2_512_256::ctx_update(const uint8_t* data, size_t len) {
-			uint32_t left, fill, rlen = len;
-			const uint8_t* ptr = data;
 
-			if (len != 0) {
+		// SHA-3 (or SHAKE) of the 'len' bytes at 'data' at rate _Rate, hashed on the stack
+		template <size_t _Rate, uint8_t _Suffix = 0x06, size_t _Digest = 100 - _Rate / 2>
+		static bool sha3(const uint8_t* data, size_t len, std::string& out) {
+			out.resize(_Digest * 2);
+			hashpp::simd::sha3<_Rate, _Suffix, _Digest>(data, len, &out[0]);
+			return true;
+		}
 
-				left = this->context.count[0] & 0x7F; fill = 128 - left;
+		// BLAKE2b-512 (_Word = uint64_t) or BLAKE2s-256 of the 'len' bytes at 'data', hashed on the stack
+		template <class _Word>
+		static bool blake2(const uint8_t* data, size_t len, std::string& out) {
+			out.resize(16 * sizeof(_Word));
+			hashpp::simd::blake2<_Word>(data, len, &out[0]);
+			return true;
+		}
 
-				this->context.count[0] += len;
-				if ((this->context.count[0]) < (len)) {
-					(this->context.count[1])++;
-				}
+		template <class _Ty>
+		static constexpr bool isSHA256() {
+			return std::is_same_v<_Ty, hashpp::SHA::SHA2_224> || std::is_same_v<_Ty, hashpp::SHA::SHA2_256>;
+		}
 
-				if ((left > 0) && (rlen >= fill)) {
-					memcpy(this->context.data + left, ptr, fill);
-					this->ctx_transform(this->context.data);
-					ptr += fill;
-					rlen -= fill;
-					left = 0;
-				}
+		template <class _Ty>
+		static constexpr bool isSHA512() {
+			return std::is_same_v<_Ty, hashpp::SHA::SHA2_384> || std::is_same_v<_Ty, hashpp::SHA::SHA2_512> ||
+				std::is_same_v<_Ty, hashpp::SHA::SHA2_512_224> || std::is_same_v<_Ty, hashpp::SHA::SHA2_512_256>;
+		}
 
-				while (rlen >= 128) {
-					this->ctx_transform(ptr);
-					ptr += 128;
-					rlen -= 128;
-				}
+		template <class _Ty>
+		static constexpr bool isKeccak() {
+			return std::is_same_v<_Ty, hashpp::SHA::SHA3_224> || std::is_same_v<_Ty, hashpp::SHA::SHA3_256> ||
+				std::is_same_v<_Ty, hashpp::SHA::SHA3_384> || std::is_same_v<_Ty, hashpp::SHA::SHA3_512> ||
+				std::is_same_v<_Ty, hashpp::SHA::SHAKE128> || std::is_same_v<_Ty, hashpp::SHA::SHAKE256>;
+		}
 
-				if (rlen > 0) {
-					memcpy(this->context.data + left, ptr, rlen);
-				}
-			}
+		// Keccak rate (in bytes) and domain separation suffix of the SHA-3 and SHAKE classes
+		template <class _Ty>
+		static constexpr size_t rate() {
+			if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA3_224>) { return 144; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA3_256> || std::is_same_v<_Ty, hashpp::SHA::SHAKE256>) { return 136; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA3_384>) { return 104; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA3_512>) { return 72; }
+			else { return 168; }
 		}
-		inline void hashpp::SHA::SHA2_512_256::ctx_final() {
-			uint32_t block_present = 0;
-			uint8_t last_padded_block[2 * 128];
 
-			memset(last_padded_block, 0, sizeof(last_padded_block));
+		template <class _Ty>
+		static constexpr uint8_t suffix() {
+			return std::is_same_v<_Ty, hashpp::SHA::SHAKE128> || std::is_same_v<_Ty, hashpp::SHA::SHAKE256> ? 0x1F : 0x06;
+		}
 
-			block_present = this->context.count[0] % 128;
-			if (block_present != 0) {
-				memcpy(last_padded_block, this->context.data, block_present);
-			}
+		template <class _Ty>
+		static constexpr const auto* initialValues() {
+			if constexpr (std::is_same_v<_Ty, hashpp::MD::MD5> || std::is_same_v<_Ty, hashpp::MD::MD4>) { return hashpp::simd::MD5_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA1>) { return hashpp::simd::SHA1_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_224>) { return hashpp::simd::SHA224_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_256>) { return hashpp::simd::SHA256_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_384>) { return hashpp::simd::SHA384_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_512>) { return hashpp::simd::SHA512_H; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_512_224>) { return hashpp::simd::SHA512_224_H; }
+			else { return hashpp::simd::SHA512_256_H; }
+		}
 
-			last_padded_block[block_present] = 0x80;
+		template <class _Ty>
+		static constexpr size_t digestSize() {
+			if constexpr (std::is_same_v<_Ty, hashpp::MD::MD5> || std::is_same_v<_Ty, hashpp::MD::MD4>) { return 16; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA1>) { return 20; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_224> || std::is_same_v<_Ty, hashpp::SHA::SHA2_512_224> ||
+				std::is_same_v<_Ty, hashpp::SHA::SHA3_224>) { return 28; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_384> || std::is_same_v<_Ty, hashpp::SHA::SHA3_384>) { return 48; }
+			else if constexpr (std::is_same_v<_Ty, hashpp::SHA::SHA2_512> || std::is_same_v<_Ty, hashpp::SHA::SHA3_512> ||
+				std::is_same_v<_Ty, hashpp::SHA::SHAKE256>) { return 64; }
+			else { return 32; }
+		}
 
-			if (block_present > (128 - 1 - (2 * sizeof(uint64_t)))) {
-				PU128B(this->context.count[0], this->context.count[1], last_padded_block, 2 * (128 - sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
-				this->ctx_transform(last_padded_block + 128);
-			}
-			else {
-				PU128B(this->context.count[0], this->context.count[1],
-					last_padded_block,
-					128 - (2 * sizeof(uint64_t)));
-				this->ctx_transform(last_padded_block);
+		// hashes 'data' through the fastest available MD5 multi-buffer kernel,
+		// starting from state 'iv' with 'prefix' bytes already compressed;
+		// returns false if no kernel is available for this batch
+		static bool md5(const std::vector<std::string>& data, std::vector<std::string>& out,
+			const uint32_t* iv, size_t digestSize, uint64_t prefix, bool hex, bool utf16) {
+#if defined(HASHPP_X86)
+			if (data.size() >= 16 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::multibuffer<hashpp::simd::md5_traits, 16>(
+					hashpp::simd::md5_x16_avx512, hashpp::simd::md5_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::md5_traits, 8>(
+					hashpp::simd::md5_x8_avx2, hashpp::simd::md5_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
 			}
-
-			PU64B(this->context.state[0], this->context.digest, 0);
-			PU64B(this->context.state[1], this->context.digest, 8);
-			PU64B(this->context.state[2], this->context.digest, 16);
-			PU64B(this->context.state[3], this->context.digest, 24);
+#endif
+			(void)data; (void)out; (void)iv; (void)digestSize; (void)prefix; (void)hex; (void)utf16;
+			return false;
 		}
-		inline std::string SHA2_512_256::_H(const std::string& a, const std::string& b) {
-			return this->getHash(a + b);
+
+		// hashes 'data' through the fastest available multi-lane MD2 kernel; the
+		// portable interleaved kernel already beats one message at a time, so
+		// only a single message is left to the MD2 class
+		static bool md2(const std::vector<std::string>& data, std::vector<std::string>& out, bool utf16) {
+			if (data.size() < 2) {
+				return false;
+			}
+#if defined(HASHPP_X86)
+			if (hashpp::cpu::hasAVX512VBMI()) {
+				hashpp::simd::md2_multibuffer<64>(hashpp::simd::md2_x64_avx512vbmi).run(data, out, utf16);
+				return true;
+			}
+#endif
+			hashpp::simd::md2_multibuffer<8>(hashpp::simd::md2_interleaved<8>).run(data, out, utf16);
+			return true;
 		}
-		inline std::string SHA2_512_256::HMAC(const std::string& key, const std::string& data) {
-			uint8_t k[128] = {0};
 
-			// (1) append zeros to the end of K to create a B byte string
-			// (e.g., if K is of length 20 bytes and B = 64, then K will be
-			//	appended with 44 zero bytes 0x00) where B is the block size
-			if (key.length() > this->BLOCK_SIZE) {
-				// if K is longer than B bytes, reset K to K=H(K)
-				// where K can either be composed of entirely bytes of H(K)
-				// (if H(K) == L [where L => digest]) or the first L bytes of
-				// H(K) (if H(K) != L) followed by the remaining zeros (if H(K) < L)
-				std::vector<uint8_t> k_ = this->fromHex(this->getHash(key));
-				for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-					k[i] = k_[i];
-				}
+		// MD4 counterpart of md5 above
+		static bool md4(const std::vector<std::string>& data, std::vector<std::string>& out,
+			const uint32_t* iv, size_t digestSize, uint64_t prefix, bool hex, bool utf16) {
+#if defined(HASHPP_X86)
+			if (data.size() >= 16 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::multibuffer<hashpp::simd::md4_traits, 16>(
+					hashpp::simd::md4_x16_avx512, hashpp::simd::md4_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::md4_traits, 8>(
+					hashpp::simd::md4_x8_avx2, hashpp::simd::md4_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
 			}
-			else {
-				// if K is shorter than B bytes, append zeros to the end of K
-				// until K is B bytes long
-				for (uint32_t i = 0; i < key.length(); ++i) {
-					k[i] = key[i];
-				}
+#endif
+			(void)data; (void)out; (void)iv; (void)digestSize; (void)prefix; (void)hex; (void)utf16;
+			return false;
+		}
+
+		// SHA-1 counterpart of md5 above
+		static bool sha1(const std::vector<std::string>& data, std::vector<std::string>& out,
+			const uint32_t* iv, size_t digestSize, uint64_t prefix, bool hex, bool utf16) {
+#if defined(HASHPP_X86)
+			// SHA-1 rounds are cheap enough that eight full AVX2 lanes also
+			// outpace a single SHA-NI stream, unlike SHA-256 below
+			if (data.size() >= 16 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 16>(
+					hashpp::simd::sha1_x16_avx512, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() >= 8 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 8>(
+					hashpp::simd::sha1_x8_avx2, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			// two interleaved SHA-NI streams keep more of the SHA unit busy than one
+			if (data.size() > 1 && hashpp::cpu::hasSHA()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 2>(
+					hashpp::simd::sha1_xn_ni<2>, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (hashpp::cpu::hasSHA()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 1>(
+					hashpp::simd::sha1_x1_ni, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 8>(
+					hashpp::simd::sha1_x8_avx2, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasSSSE3()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha1_traits, 4>(
+					hashpp::simd::sha1_x4_ssse3, hashpp::simd::sha1_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
 			}
+#endif
+			(void)data; (void)out; (void)iv; (void)digestSize; (void)prefix; (void)hex; (void)utf16;
+			return false;
+		}
 
-			// (2) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with ipad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->ipad[i] ^= k[i];
+		// SHA2-224/SHA2-256 counterpart of md5 above
+		static bool sha256(const std::vector<std::string>& data, std::vector<std::string>& out,
+			const uint32_t* iv, size_t digestSize, uint64_t prefix, bool hex, bool utf16) {
+#if defined(HASHPP_X86)
+			// sixteen AVX-512 lanes outpace a single SHA-NI stream once a batch
+			// can fill them, while a single SHA-NI stream outpaces eight AVX2
+			// lanes, so the AVX2 kernel is reserved for processors without either
+			if (data.size() >= 16 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha256_traits, 16>(
+					hashpp::simd::sha256_x16_avx512, hashpp::simd::sha256_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			// two interleaved SHA-NI streams keep more of the SHA unit busy than one
+			if (data.size() > 1 && hashpp::cpu::hasSHA()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha256_traits, 2>(
+					hashpp::simd::sha256_xn_ni<2>, hashpp::simd::sha256_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (hashpp::cpu::hasSHA()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha256_traits, 1>(
+					hashpp::simd::sha256_x1_ni, hashpp::simd::sha256_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha256_traits, 8>(
+					hashpp::simd::sha256_x8_avx2, hashpp::simd::sha256_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
 			}
+#endif
+			(void)data; (void)out; (void)iv; (void)digestSize; (void)prefix; (void)hex; (void)utf16;
+			return false;
+		}
 
-			// (3) append the stream of data 'data' to the B byte string resulting from step (2)
-			for (uint32_t i = 0; i < data.length(); ++i) {
-				this->ipad.push_back(data[i]);
+		// SHA2-384/SHA2-512 family counterpart of md5 above; the family has no
+		// dedicated instructions, so batches always go through the vector lanes
+		static bool sha512(const std::vector<std::string>& data, std::vector<std::string>& out,
+			const uint64_t* iv, size_t digestSize, uint64_t prefix, bool hex, bool utf16) {
+#if defined(HASHPP_X86)
+			if (data.size() >= 8 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha512_traits, 8>(
+					hashpp::simd::sha512_x8_avx512, hashpp::simd::sha512_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::multibuffer<hashpp::simd::sha512_traits, 4>(
+					hashpp::simd::sha512_x4_avx2, hashpp::simd::sha512_blocks, iv, digestSize, prefix
+				).run(data, out, hex, utf16);
+				return true;
 			}
+#endif
+			(void)data; (void)out; (void)iv; (void)digestSize; (void)prefix; (void)hex; (void)utf16;
+			return false;
+		}
 
-			// (4) apply H to the stream generated in step (3)
-			// see step (6)
+		// hashes 'data' through the fastest available multi-lane Keccak kernel, for
+		// SHA-3 or SHAKE at rate 'rate' with domain separation suffix 'suffix'; as
+		// with SHA2-512, there are no dedicated instructions to prefer
+		static bool keccak(const std::vector<std::string>& data, std::vector<std::string>& out,
+			size_t rate, uint8_t suffix, size_t digestSize, bool utf16) {
+#if defined(HASHPP_X86)
+			if (data.size() >= 8 && hashpp::cpu::hasAVX512()) {
+				hashpp::simd::keccak_multibuffer<8>(
+					hashpp::simd::keccak_x8_avx512, hashpp::simd::keccak_blocks, rate, suffix, digestSize
+				).run(data, out, utf16);
+				return true;
+			}
+			if (data.size() > 1 && hashpp::cpu::hasAVX2()) {
+				hashpp::simd::keccak_multibuffer<4>(
+					hashpp::simd::keccak_x4_avx2, hashpp::simd::keccak_blocks, rate, suffix, digestSize
+				).run(data, out, utf16);
+				return true;
+			}
+#endif
+			(void)data; (void)out; (void)rate; (void)suffix; (void)digestSize; (void)utf16;
+			return false;
+		}
 
-			// (5) XOR (bitwise exclusive-OR) the B byte string computed in step (1) with opad
-			for (uint32_t i = 0; i < this->BLOCK_SIZE; ++i) {
-				this->opad[i] ^= k[i];
+		// HMAC as per: https://datatracker.ietf.org/doc/html/rfc2104 for a whole batch;
+		// the (K ^ ipad) and (K ^ opad) blocks are compressed once, and every inner and
+		// outer hash of the batch then starts from those saved states in 'runner'
+		template <class _Traits>
+		static bool hmac(const std::string& key, const std::vector<std::string>& data, std::vector<std::string>& out,
+			const typename _Traits::word* iv, size_t digestSize,
+			void (*single)(typename _Traits::word*, const uint8_t*, size_t),
+			bool (*runner)(const std::vector<std::string>&, std::vector<std::string>&, const typename _Traits::word*, size_t, uint64_t, bool, bool)) {
+			typedef typename _Traits::word word;
+			uint8_t k[_Traits::BLOCK] = { 0 }, ipad[_Traits::BLOCK], opad[_Traits::BLOCK];
+			word istate[_Traits::WORDS], ostate[_Traits::WORDS];
+			std::vector<std::string> inner;
+
+			// keys longer than the block size are replaced by their digest
+			if (key.length() > _Traits::BLOCK) {
+				std::vector<std::string> hashed;
+				if (!runner({ key }, hashed, iv, digestSize, 0, false, false)) {
+					return false;
+				}
+				memcpy(k, hashed[0].data(), digestSize);
+			}
+			else {
+				memcpy(k, key.data(), key.length());
 			}
 
-			// (6) append the H result from step (4) to the B byte string resulting from step (5)
-			std::vector<uint8_t> h_ = this->fromHex(this->getHash(std::string(this->ipad.begin(), this->ipad.end())));
-			for (uint32_t i = 0; i < this->DIGEST_SIZE; ++i) {
-				this->opad.push_back(h_[i]);
+			for (size_t i = 0; i < _Traits::BLOCK; ++i) {
+				ipad[i] = k[i] ^ 0x36;
+				opad[i] = k[i] ^ 0x5c;
 			}
+			memcpy(istate, iv, sizeof(istate));
+			memcpy(ostate, iv, sizeof(ostate));
+			single(istate, ipad, 1);
+			single(ostate, opad, 1);
 
-			// (7) apply H to the stream generated in step (6) and output the result
-			return this->getHash(std::string(this->opad.begin(), this->opad.end()));
+			inner.reserve(data.size());
+			if (!runner(data, inner, istate, digestSize, _Traits::BLOCK, false, false)) {
+				return false;
+			}
+			return runner(inner, out, ostate, digestSize, _Traits::BLOCK, true, false);
 		}
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::F(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (~A & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::G(const uint64_t A, const uint64_t B, const uint64_t C) { return ((A & B) ^ (A & C) ^ (B & C)); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::SIGMA0(const uint64_t A) { return this->rr64(A, 28) ^ this->rr64(A, 34) ^ this->rr64(A, 39); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::SIGMA1(const uint64_t A) { return this->rr64(A, 14) ^ this->rr64(A, 18) ^ this->rr64(A, 41); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::SIGMA2(const uint64_t A) { return this->rr64(A, 1) ^ this->rr64(A, 8) ^ (A >> 7); }
-		constexpr uint64_t hashpp::SHA::SHA2_512_256::SIGMA3(const uint64_t A) { return this->rr64(A, 19) ^ this->rr64(A, 61) ^ (A >> 6); }
-	}
-
+	};
 
 	// class used to store hash retrieved from get*Hash
 	// this class is used as an interface to access a
@@ -3092,6 +8620,11 @@ namespace hashpp {
 	public:
 		// function to return a resulting hash from selected ALGORITHM and passed data
 		static hashpp::hash getHash(hashpp::ALGORITHMS algorithm, const std::string& data) {
+			// messages that fit in two blocks skip the algorithm objects entirely
+			if (std::string digest; hashpp::batch::shortHash(algorithm, data, digest)) {
+				return { std::move(digest) };
+			}
+
 			switch (algorithm) {
 			case hashpp::ALGORITHMS::MD5:
 			{
@@ -3133,6 +8666,42 @@ namespace hashpp {
 			{
 				return { hashpp::SHA::SHA2_512_256().getHash(data) };
 			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				return { hashpp::SHA::SHA3_224().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				return { hashpp::SHA::SHA3_256().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				return { hashpp::SHA::SHA3_384().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				return { hashpp::SHA::SHA3_512().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			{
+				return { hashpp::SHA::SHAKE128().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				return { hashpp::SHA::SHAKE256().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				return { hashpp::BLAKE::BLAKE2b().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				return { hashpp::BLAKE::BLAKE2s().getHash(data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				return { hashpp::BLAKE::BLAKE3().getHash(data) };
+			}
 			default:
 			{
 				return hashpp::hash();
@@ -3140,6 +8709,15 @@ namespace hashpp {
 			}
 		}
 
+		// function to return a resulting hash from selected ALGORITHM and the _N bytes at 'data', for
+		// inputs of a size known at compile time (e.g., getFixedHash<ALGORITHMS::SHA2_256, 32>(key.data()))
+		template <hashpp::ALGORITHMS _Algorithm, size_t _N>
+		static hashpp::hash getFixedHash(const void* data) {
+			std::string digest;
+			hashpp::batch::fixedHash<_Algorithm, _N>(static_cast<const uint8_t*>(data), digest);
+			return { std::move(digest) };
+		}
+
 		// function to return a resulting HMAC from selected ALGORITHM and passed key-data pair
 		static hashpp::hash getHMAC(hashpp::ALGORITHMS algorithm, const std::string& key, const std::string& data) {
 			switch (algorithm) {
@@ -3183,6 +8761,34 @@ namespace hashpp {
 			{
 				return { hashpp::SHA::SHA2_512_256().getHMAC(key, data) };
 			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				return { hashpp::SHA::SHA3_224().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				return { hashpp::SHA::SHA3_256().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				return { hashpp::SHA::SHA3_384().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				return { hashpp::SHA::SHA3_512().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				return { hashpp::BLAKE::BLAKE2b().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				return { hashpp::BLAKE::BLAKE2s().getHMAC(key, data) };
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				return { hashpp::BLAKE::BLAKE3().getHMAC(key, data) };
+			}
 			default:
 			{
 				return hashpp::hash();
@@ -3190,79 +8796,106 @@ namespace hashpp {
 			}
 		}
 
-		// function to return a collection of resulting hashes from passed data container(s)
-		static hashpp::hashCollection getHashes(const DataContainer& dataSet) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+		// function to return a collection of resulting hashes from passed data container(s),
+		// with the data optionally hashed as UTF-16LE (see ENCODINGS)
+		static hashpp::hashCollection getHashes(const DataContainer& dataSet, hashpp::ENCODINGS encoding = hashpp::ENCODINGS::BYTES) {
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			switch (dataSet.getAlgorithm()) {
 			case hashpp::ALGORITHMS::MD5:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vMD5.push_back(hashpp::MD::MD5().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::MD::MD5>(dataSet.getData(), vMD5, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::MD4:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vMD4.push_back(hashpp::MD::MD4().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::MD::MD4>(dataSet.getData(), vMD4, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::MD2:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vMD2.push_back(hashpp::MD::MD2().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::MD::MD2>(dataSet.getData(), vMD2, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA1:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA1.push_back(hashpp::SHA::SHA1().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA1>(dataSet.getData(), vSHA1, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_224:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_224>(dataSet.getData(), vSHA2_224, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_256:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_256>(dataSet.getData(), vSHA2_256, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_384:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_384>(dataSet.getData(), vSHA2_384, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512>(dataSet.getData(), vSHA2_512, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_224:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_224>(dataSet.getData(), vSHA2_512_224, encoding);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_256:
 			{
-				for (const std::string& data : dataSet.getData()) {
-					vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(data));
-				}
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_256>(dataSet.getData(), vSHA2_512_256, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_224>(dataSet.getData(), vSHA3_224, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_256>(dataSet.getData(), vSHA3_256, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_384>(dataSet.getData(), vSHA3_384, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_512>(dataSet.getData(), vSHA3_512, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHAKE128>(dataSet.getData(), vSHAKE128, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				hashpp::batch::appendHashes<hashpp::SHA::SHAKE256>(dataSet.getData(), vSHAKE256, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2b>(dataSet.getData(), vBLAKE2B, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2s>(dataSet.getData(), vBLAKE2S, encoding);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE3>(dataSet.getData(), vBLAKE3, encoding);
 				break;
 			}
 			}
@@ -3277,85 +8910,121 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
-		// function to return a collection of resulting hashes from passed data container(s)
-		static hashpp::hashCollection getHashes(const std::vector<DataContainer>& dataSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+		// function to return a collection of resulting hashes from passed data container(s),
+		// with the data optionally hashed as UTF-16LE (see ENCODINGS)
+		static hashpp::hashCollection getHashes(const std::vector<DataContainer>& dataSets, hashpp::ENCODINGS encoding = hashpp::ENCODINGS::BYTES) {
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const DataContainer& dataSet : dataSets) {
 				switch (dataSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD5.push_back(hashpp::MD::MD5().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD5>(dataSet.getData(), vMD5, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD4.push_back(hashpp::MD::MD4().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD4>(dataSet.getData(), vMD4, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD2:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD2.push_back(hashpp::MD::MD2().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD2>(dataSet.getData(), vMD2, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA1.push_back(hashpp::SHA::SHA1().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA1>(dataSet.getData(), vSHA1, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_224>(dataSet.getData(), vSHA2_224, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_256>(dataSet.getData(), vSHA2_256, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_384>(dataSet.getData(), vSHA2_384, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512>(dataSet.getData(), vSHA2_512, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_224>(dataSet.getData(), vSHA2_512_224, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_256>(dataSet.getData(), vSHA2_512_256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_224>(dataSet.getData(), vSHA3_224, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_256>(dataSet.getData(), vSHA3_256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_384>(dataSet.getData(), vSHA3_384, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_512>(dataSet.getData(), vSHA3_512, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHAKE128>(dataSet.getData(), vSHAKE128, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHAKE256>(dataSet.getData(), vSHAKE256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2b>(dataSet.getData(), vBLAKE2B, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2s>(dataSet.getData(), vBLAKE2S, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE3>(dataSet.getData(), vBLAKE3, encoding);
 					break;
 				}
 				}
@@ -3371,85 +9040,121 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
-		// function to return a collection of resulting hashes from passed data container(s)
-		static hashpp::hashCollection getHashes(const std::initializer_list<DataContainer>& dataSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+		// function to return a collection of resulting hashes from passed data container(s),
+		// with the data optionally hashed as UTF-16LE (see ENCODINGS)
+		static hashpp::hashCollection getHashes(const std::initializer_list<DataContainer>& dataSets, hashpp::ENCODINGS encoding = hashpp::ENCODINGS::BYTES) {
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const DataContainer& dataSet : dataSets) {
 				switch (dataSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD5.push_back(hashpp::MD::MD5().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD5>(dataSet.getData(), vMD5, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD4.push_back(hashpp::MD::MD4().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD4>(dataSet.getData(), vMD4, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD2:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vMD2.push_back(hashpp::MD::MD2().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::MD::MD2>(dataSet.getData(), vMD2, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA1.push_back(hashpp::SHA::SHA1().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA1>(dataSet.getData(), vSHA1, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_224>(dataSet.getData(), vSHA2_224, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_256>(dataSet.getData(), vSHA2_256, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_384>(dataSet.getData(), vSHA2_384, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512>(dataSet.getData(), vSHA2_512, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_224>(dataSet.getData(), vSHA2_512_224, encoding);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& data : dataSet.getData()) {
-						vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(data));
-					}
+					hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_256>(dataSet.getData(), vSHA2_512_256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_224>(dataSet.getData(), vSHA3_224, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_256>(dataSet.getData(), vSHA3_256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_384>(dataSet.getData(), vSHA3_384, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHA3_512>(dataSet.getData(), vSHA3_512, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHAKE128>(dataSet.getData(), vSHAKE128, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					hashpp::batch::appendHashes<hashpp::SHA::SHAKE256>(dataSet.getData(), vSHAKE256, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2b>(dataSet.getData(), vBLAKE2B, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2s>(dataSet.getData(), vBLAKE2S, encoding);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE3>(dataSet.getData(), vBLAKE3, encoding);
 					break;
 				}
 				}
@@ -3465,7 +9170,16 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
@@ -3478,76 +9192,129 @@ namespace hashpp {
 			case hashpp::ALGORITHMS::MD5:
 			{
 				std::vector<std::string> vMD5;
-				(vMD5.push_back(hashpp::MD::MD5().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::MD::MD5>({ static_cast<std::string>(data)... }, vMD5);
 				return hashCollection{ {{ "MD5", vMD5 }} };
 			}
 			case hashpp::ALGORITHMS::MD4:
 			{
 				std::vector<std::string> vMD4;
-				(vMD4.push_back(hashpp::MD::MD4().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::MD::MD4>({ static_cast<std::string>(data)... }, vMD4);
 				return hashCollection{ {{ "MD4", vMD4 }} };
 			}
 			case hashpp::ALGORITHMS::MD2:
 			{
 				std::vector<std::string> vMD2;
-				(vMD2.push_back(hashpp::MD::MD2().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::MD::MD2>({ static_cast<std::string>(data)... }, vMD2);
 				return hashCollection{ {{ "MD2", vMD2 }} };
 			}
 			case hashpp::ALGORITHMS::SHA1:
 			{
 				std::vector<std::string> vSHA1;
-				(vSHA1.push_back(hashpp::SHA::SHA1().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA1>({ static_cast<std::string>(data)... }, vSHA1);
 				return hashCollection{ {{ "SHA1", vSHA1 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_224:
 			{
 				std::vector<std::string> vSHA2_224;
-				(vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_224>({ static_cast<std::string>(data)... }, vSHA2_224);
 				return hashCollection{ {{ "SHA2-224", vSHA2_224 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_256:
 			{
 				std::vector<std::string> vSHA2_256;
-				(vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_256>({ static_cast<std::string>(data)... }, vSHA2_256);
 				return hashCollection{ {{ "SHA2-256", vSHA2_256 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_384:
 			{
 				std::vector<std::string> vSHA_384;
-				(vSHA_384.push_back(hashpp::SHA::SHA2_384().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_384>({ static_cast<std::string>(data)... }, vSHA_384);
 				return hashCollection{ {{ "SHA2-384", vSHA_384 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512:
 			{
 				std::vector<std::string> vSHA2_512;
-				(vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512>({ static_cast<std::string>(data)... }, vSHA2_512);
 				return hashCollection{ {{ "SHA2-512", vSHA2_512 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512_224:
 			{
 				std::vector<std::string> vSHA2_512_224;
-				(vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_224>({ static_cast<std::string>(data)... }, vSHA2_512_224);
 				return hashCollection{ {{ "SHA2-512-224", vSHA2_512_224 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512_256:
 			{
 				std::vector<std::string> vSHA2_512_256;
-				(vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(static_cast<std::string>(data))), ...);
+				hashpp::batch::appendHashes<hashpp::SHA::SHA2_512_256>({ static_cast<std::string>(data)... }, vSHA2_512_256);
 				return hashCollection{ {{ "SHA2-512-256", vSHA2_512_256 }} };
 			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				std::vector<std::string> vSHA3_224;
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_224>({ static_cast<std::string>(data)... }, vSHA3_224);
+				return hashCollection{ {{ "SHA3-224", vSHA3_224 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				std::vector<std::string> vSHA3_256;
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_256>({ static_cast<std::string>(data)... }, vSHA3_256);
+				return hashCollection{ {{ "SHA3-256", vSHA3_256 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				std::vector<std::string> vSHA3_384;
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_384>({ static_cast<std::string>(data)... }, vSHA3_384);
+				return hashCollection{ {{ "SHA3-384", vSHA3_384 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				std::vector<std::string> vSHA3_512;
+				hashpp::batch::appendHashes<hashpp::SHA::SHA3_512>({ static_cast<std::string>(data)... }, vSHA3_512);
+				return hashCollection{ {{ "SHA3-512", vSHA3_512 }} };
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			{
+				std::vector<std::string> vSHAKE128;
+				hashpp::batch::appendHashes<hashpp::SHA::SHAKE128>({ static_cast<std::string>(data)... }, vSHAKE128);
+				return hashCollection{ {{ "SHAKE128", vSHAKE128 }} };
+			}
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				std::vector<std::string> vSHAKE256;
+				hashpp::batch::appendHashes<hashpp::SHA::SHAKE256>({ static_cast<std::string>(data)... }, vSHAKE256);
+				return hashCollection{ {{ "SHAKE256", vSHAKE256 }} };
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				std::vector<std::string> vBLAKE2B;
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2b>({ static_cast<std::string>(data)... }, vBLAKE2B);
+				return hashCollection{ {{ "BLAKE2b", vBLAKE2B }} };
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				std::vector<std::string> vBLAKE2S;
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE2s>({ static_cast<std::string>(data)... }, vBLAKE2S);
+				return hashCollection{ {{ "BLAKE2s", vBLAKE2S }} };
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				std::vector<std::string> vBLAKE3;
+				hashpp::batch::appendHashes<hashpp::BLAKE::BLAKE3>({ static_cast<std::string>(data)... }, vBLAKE3);
+				return hashCollection{ {{ "BLAKE3", vBLAKE3 }} };
+			}
 			}
 		}
 
 		// function to return a collection of resulting HMACs from selected ALGORITHMS and passed key-data container(s)
 		static hashpp::hashCollection getHMACs(const HMAC_DataContainer& keyDataSet) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			switch (keyDataSet.getAlgorithm()) {
 			case hashpp::ALGORITHMS::MD5:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vMD5.push_back(hashpp::MD::MD5().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::MD::MD5>(keyDataSet.getKey(), keyDataSet.getData(), vMD5);
 				break;
 			}
 			case hashpp::ALGORITHMS::MD4:
@@ -3566,51 +9333,78 @@ namespace hashpp {
 			}
 			case hashpp::ALGORITHMS::SHA1:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA1.push_back(hashpp::SHA::SHA1().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA1>(keyDataSet.getKey(), keyDataSet.getData(), vSHA1);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_224:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_224);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_256:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_256);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_384:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_384);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_224:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_224);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_256:
 			{
-				for (const std::string& data : keyDataSet.getData()) {
-					vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHMAC(keyDataSet.getKey(), data));
-				}
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_256);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_224);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_256);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_384);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_512);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				// extendable-output functions have no HMAC construction
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2b>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2B);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2s>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2S);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE3>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE3);
 				break;
 			}
 			}
@@ -3625,22 +9419,28 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
 		// function to return a collection of resulting HMACs from selected ALGORITHMS and passed key-data container(s)
 		static hashpp::hashCollection getHMACs(const std::vector<HMAC_DataContainer>& keyDataSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const DataContainer& keyDataSet : keyDataSets) {
 				switch (keyDataSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vMD5.push_back(hashpp::MD::MD5().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::MD::MD5>(keyDataSet.getKey(), keyDataSet.getData(), vMD5);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
@@ -3659,51 +9459,78 @@ namespace hashpp {
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA1.push_back(hashpp::SHA::SHA1().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA1>(keyDataSet.getKey(), keyDataSet.getData(), vSHA1);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_256);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_384);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_224);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_384);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_512);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					// extendable-output functions have no HMAC construction
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2b>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2B);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2s>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2S);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE3>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE3);
 					break;
 				}
 				}
@@ -3719,22 +9546,28 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
 		// function to return a collection of resulting HMACs from selected ALGORITHMS and passed key-data container(s)
 		static hashpp::hashCollection getHMACs(const std::initializer_list<HMAC_DataContainer>& keyDataSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const DataContainer& keyDataSet : keyDataSets) {
 				switch (keyDataSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vMD5.push_back(hashpp::MD::MD5().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::MD::MD5>(keyDataSet.getKey(), keyDataSet.getData(), vMD5);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
@@ -3753,51 +9586,78 @@ namespace hashpp {
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA1.push_back(hashpp::SHA::SHA1().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA1>(keyDataSet.getKey(), keyDataSet.getData(), vSHA1);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_256);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_384);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& data : keyDataSet.getData()) {
-						vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHMAC(keyDataSet.getKey(), data));
-					}
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA2_512_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_224>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_224);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_256>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_384>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_384);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					hashpp::batch::appendHMACs<hashpp::SHA::SHA3_512>(keyDataSet.getKey(), keyDataSet.getData(), vSHA3_512);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					// extendable-output functions have no HMAC construction
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2b>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2B);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2s>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE2S);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE3>(keyDataSet.getKey(), keyDataSet.getData(), vBLAKE3);
 					break;
 				}
 				}
@@ -3813,7 +9673,14 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
@@ -3826,7 +9693,7 @@ namespace hashpp {
 			case hashpp::ALGORITHMS::MD5:
 			{
 				std::vector<std::string> vMD5;
-				(vMD5.push_back(hashpp::MD::MD5().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::MD::MD5>(key, { static_cast<std::string>(data)... }, vMD5);
 				return hashCollection{ {{ "MD5", vMD5 }} };
 			}
 			case hashpp::ALGORITHMS::MD4:
@@ -3844,45 +9711,93 @@ namespace hashpp {
 			case hashpp::ALGORITHMS::SHA1:
 			{
 				std::vector<std::string> vSHA1;
-				(vSHA1.push_back(hashpp::SHA::SHA1().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA1>(key, { static_cast<std::string>(data)... }, vSHA1);
 				return hashCollection{ {{ "SHA1", vSHA1 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_224:
 			{
 				std::vector<std::string> vSHA2_224;
-				(vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_224>(key, { static_cast<std::string>(data)... }, vSHA2_224);
 				return hashCollection{ {{ "SHA2-224", vSHA2_224 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_256:
 			{
 				std::vector<std::string> vSHA2_256;
-				(vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_256>(key, { static_cast<std::string>(data)... }, vSHA2_256);
 				return hashCollection{ {{ "SHA2-256", vSHA2_256 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_384:
 			{
 				std::vector<std::string> vSHA_384;
-				(vSHA_384.push_back(hashpp::SHA::SHA2_384().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_384>(key, { static_cast<std::string>(data)... }, vSHA_384);
 				return hashCollection{ {{ "SHA2-384", vSHA_384 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512:
 			{
 				std::vector<std::string> vSHA2_512;
-				(vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512>(key, { static_cast<std::string>(data)... }, vSHA2_512);
 				return hashCollection{ {{ "SHA2-512", vSHA2_512 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512_224:
 			{
 				std::vector<std::string> vSHA2_512_224;
-				(vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_224>(key, { static_cast<std::string>(data)... }, vSHA2_512_224);
 				return hashCollection{ {{ "SHA2-512-224", vSHA2_512_224 }} };
 			}
 			case hashpp::ALGORITHMS::SHA2_512_256:
 			{
 				std::vector<std::string> vSHA2_512_256;
-				(vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHMAC(key, data)), ...);
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA2_512_256>(key, { static_cast<std::string>(data)... }, vSHA2_512_256);
 				return hashCollection{ {{ "SHA2-512-256", vSHA2_512_256 }} };
 			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				std::vector<std::string> vSHA3_224;
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_224>(key, { static_cast<std::string>(data)... }, vSHA3_224);
+				return hashCollection{ {{ "SHA3-224", vSHA3_224 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				std::vector<std::string> vSHA3_256;
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_256>(key, { static_cast<std::string>(data)... }, vSHA3_256);
+				return hashCollection{ {{ "SHA3-256", vSHA3_256 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				std::vector<std::string> vSHA3_384;
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_384>(key, { static_cast<std::string>(data)... }, vSHA3_384);
+				return hashCollection{ {{ "SHA3-384", vSHA3_384 }} };
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				std::vector<std::string> vSHA3_512;
+				hashpp::batch::appendHMACs<hashpp::SHA::SHA3_512>(key, { static_cast<std::string>(data)... }, vSHA3_512);
+				return hashCollection{ {{ "SHA3-512", vSHA3_512 }} };
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				// extendable-output functions have no HMAC construction
+				return hashCollection();
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				std::vector<std::string> vBLAKE2B;
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2b>(key, { static_cast<std::string>(data)... }, vBLAKE2B);
+				return hashCollection{ {{ "BLAKE2b", vBLAKE2B }} };
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				std::vector<std::string> vBLAKE2S;
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE2s>(key, { static_cast<std::string>(data)... }, vBLAKE2S);
+				return hashCollection{ {{ "BLAKE2s", vBLAKE2S }} };
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				std::vector<std::string> vBLAKE3;
+				hashpp::batch::appendHMACs<hashpp::BLAKE::BLAKE3>(key, { static_cast<std::string>(data)... }, vBLAKE3);
+				return hashCollection{ {{ "BLAKE3", vBLAKE3 }} };
+			}
 			}
 		}
 
@@ -3930,6 +9845,42 @@ namespace hashpp {
 				{
 					return { hashpp::SHA::SHA2_512_256().getHash(std::filesystem::path(path)) };
 				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					return { hashpp::SHA::SHA3_224().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					return { hashpp::SHA::SHA3_256().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					return { hashpp::SHA::SHA3_384().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					return { hashpp::SHA::SHA3_512().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				{
+					return { hashpp::SHA::SHAKE128().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					return { hashpp::SHA::SHAKE256().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					return { hashpp::BLAKE::BLAKE2b().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					return { hashpp::BLAKE::BLAKE2s().getHash(std::filesystem::path(path)) };
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					return { hashpp::BLAKE::BLAKE3().getHash(std::filesystem::path(path)) };
+				}
 				default:
 				{
 					return hashpp::hash();
@@ -3943,167 +9894,103 @@ namespace hashpp {
 
 		// function to return a collection of resulting hashes from selected ALGORITHMS and passed file path container(s) (with recursive directory support)
 		static hashpp::hashCollection getFilesHashes(const FilePathsContainer& filePathSet) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			switch (filePathSet.getAlgorithm()) {
 			case hashpp::ALGORITHMS::MD5:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vMD5.push_back(hashpp::MD::MD5().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vMD5.push_back(hashpp::MD::MD5().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::MD::MD5>(filePathSet, vMD5);
 				break;
 			}
 			case hashpp::ALGORITHMS::MD4:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vMD4.push_back(hashpp::MD::MD4().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vMD4.push_back(hashpp::MD::MD4().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::MD::MD4>(filePathSet, vMD4);
 				break;
 			}
 			case hashpp::ALGORITHMS::MD2:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vMD2.push_back(hashpp::MD::MD2().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vMD2.push_back(hashpp::MD::MD2().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::MD::MD2>(filePathSet, vMD2);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA1:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA1.push_back(hashpp::SHA::SHA1().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA1.push_back(hashpp::SHA::SHA1().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA1>(filePathSet, vSHA1);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_224:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_224>(filePathSet, vSHA2_224);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_256:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_256>(filePathSet, vSHA2_256);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_384:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_384>(filePathSet, vSHA2_384);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_512>(filePathSet, vSHA2_512);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_224:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_512_224>(filePathSet, vSHA2_512_224);
 				break;
 			}
 			case hashpp::ALGORITHMS::SHA2_512_256:
 			{
-				for (const std::string& path : filePathSet.getData()) {
-					if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-						vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(std::filesystem::path(path)));
-					}
-					else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-						for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-							if (item.is_regular_file()) {
-								vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(item.path()));
-							}
-						}
-					}
-				}
+				appendFilesHashes<hashpp::SHA::SHA2_512_256>(filePathSet, vSHA2_512_256);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_224:
+			{
+				appendFilesHashes<hashpp::SHA::SHA3_224>(filePathSet, vSHA3_224);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_256:
+			{
+				appendFilesHashes<hashpp::SHA::SHA3_256>(filePathSet, vSHA3_256);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_384:
+			{
+				appendFilesHashes<hashpp::SHA::SHA3_384>(filePathSet, vSHA3_384);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHA3_512:
+			{
+				appendFilesHashes<hashpp::SHA::SHA3_512>(filePathSet, vSHA3_512);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHAKE128:
+			{
+				appendFilesHashes<hashpp::SHA::SHAKE128>(filePathSet, vSHAKE128);
+				break;
+			}
+			case hashpp::ALGORITHMS::SHAKE256:
+			{
+				appendFilesHashes<hashpp::SHA::SHAKE256>(filePathSet, vSHAKE256);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2B:
+			{
+				appendFilesHashes<hashpp::BLAKE::BLAKE2b>(filePathSet, vBLAKE2B);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE2S:
+			{
+				appendFilesHashes<hashpp::BLAKE::BLAKE2s>(filePathSet, vBLAKE2S);
+				break;
+			}
+			case hashpp::ALGORITHMS::BLAKE3:
+			{
+				appendFilesHashes<hashpp::BLAKE::BLAKE3>(filePathSet, vBLAKE3);
 				break;
 			}
 			}
@@ -4118,175 +10005,120 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
 		// function to return a collection of resulting hashes from selected ALGORITHMS and passed file path container(s) (with recursive directory support)
 		static hashpp::hashCollection getFilesHashes(const std::vector<FilePathsContainer>& filePathSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const FilePathsContainer& filePathSet : filePathSets) {
 				switch (filePathSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD5.push_back(hashpp::MD::MD5().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD5.push_back(hashpp::MD::MD5().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD5>(filePathSet, vMD5);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD4.push_back(hashpp::MD::MD4().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD4.push_back(hashpp::MD::MD4().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD4>(filePathSet, vMD4);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD2:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD2.push_back(hashpp::MD::MD2().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD2.push_back(hashpp::MD::MD2().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD2>(filePathSet, vMD2);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA1.push_back(hashpp::SHA::SHA1().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA1.push_back(hashpp::SHA::SHA1().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA1>(filePathSet, vSHA1);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_224>(filePathSet, vSHA2_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_256>(filePathSet, vSHA2_256);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_384>(filePathSet, vSHA2_384);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512>(filePathSet, vSHA2_512);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512_224>(filePathSet, vSHA2_512_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512_256>(filePathSet, vSHA2_512_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_224>(filePathSet, vSHA3_224);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_256>(filePathSet, vSHA3_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_384>(filePathSet, vSHA3_384);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_512>(filePathSet, vSHA3_512);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				{
+					appendFilesHashes<hashpp::SHA::SHAKE128>(filePathSet, vSHAKE128);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					appendFilesHashes<hashpp::SHA::SHAKE256>(filePathSet, vSHAKE256);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE2b>(filePathSet, vBLAKE2B);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE2s>(filePathSet, vBLAKE2S);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE3>(filePathSet, vBLAKE3);
 					break;
 				}
 				}
@@ -4302,175 +10134,120 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
 
 		// function to return a collection of resulting hashes from selected ALGORITHMS and passed file path container(s) (with recursive directory support)
 		static hashpp::hashCollection getFilesHashes(const std::initializer_list<FilePathsContainer>& filePathSets) {
-			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256;
+			std::vector<std::string> vMD5, vMD4, vMD2, vSHA1, vSHA2_224, vSHA2_256, vSHA2_384, vSHA2_512, vSHA2_512_224, vSHA2_512_256,
+				vSHA3_224, vSHA3_256, vSHA3_384, vSHA3_512, vSHAKE128, vSHAKE256, vBLAKE2B, vBLAKE2S, vBLAKE3;
 
 			for (const FilePathsContainer& filePathSet : filePathSets) {
 				switch (filePathSet.getAlgorithm()) {
 				case hashpp::ALGORITHMS::MD5:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD5.push_back(hashpp::MD::MD5().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD5.push_back(hashpp::MD::MD5().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD5>(filePathSet, vMD5);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD4:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD4.push_back(hashpp::MD::MD4().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD4.push_back(hashpp::MD::MD4().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD4>(filePathSet, vMD4);
 					break;
 				}
 				case hashpp::ALGORITHMS::MD2:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vMD2.push_back(hashpp::MD::MD2().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vMD2.push_back(hashpp::MD::MD2().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::MD::MD2>(filePathSet, vMD2);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA1:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA1.push_back(hashpp::SHA::SHA1().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA1.push_back(hashpp::SHA::SHA1().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA1>(filePathSet, vSHA1);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_224:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_224.push_back(hashpp::SHA::SHA2_224().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_224>(filePathSet, vSHA2_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_256:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_256.push_back(hashpp::SHA::SHA2_256().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_256>(filePathSet, vSHA2_256);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_384:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_384.push_back(hashpp::SHA::SHA2_384().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_384>(filePathSet, vSHA2_384);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512.push_back(hashpp::SHA::SHA2_512().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512>(filePathSet, vSHA2_512);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_224:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512_224.push_back(hashpp::SHA::SHA2_512_224().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512_224>(filePathSet, vSHA2_512_224);
 					break;
 				}
 				case hashpp::ALGORITHMS::SHA2_512_256:
 				{
-					for (const std::string& path : filePathSet.getData()) {
-						if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
-							vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(std::filesystem::path(path)));
-						}
-						else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
-							for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
-								if (item.is_regular_file()) {
-									vSHA2_512_256.push_back(hashpp::SHA::SHA2_512_256().getHash(item.path()));
-								}
-							}
-						}
-					}
+					appendFilesHashes<hashpp::SHA::SHA2_512_256>(filePathSet, vSHA2_512_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_224:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_224>(filePathSet, vSHA3_224);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_256:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_256>(filePathSet, vSHA3_256);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_384:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_384>(filePathSet, vSHA3_384);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHA3_512:
+				{
+					appendFilesHashes<hashpp::SHA::SHA3_512>(filePathSet, vSHA3_512);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE128:
+				{
+					appendFilesHashes<hashpp::SHA::SHAKE128>(filePathSet, vSHAKE128);
+					break;
+				}
+				case hashpp::ALGORITHMS::SHAKE256:
+				{
+					appendFilesHashes<hashpp::SHA::SHAKE256>(filePathSet, vSHAKE256);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2B:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE2b>(filePathSet, vBLAKE2B);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE2S:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE2s>(filePathSet, vBLAKE2S);
+					break;
+				}
+				case hashpp::ALGORITHMS::BLAKE3:
+				{
+					appendFilesHashes<hashpp::BLAKE::BLAKE3>(filePathSet, vBLAKE3);
 					break;
 				}
 				}
@@ -4486,10 +10263,40 @@ namespace hashpp {
 					{ "SHA2-384", vSHA2_384 },
 					{ "SHA2-512", vSHA2_512 },
 					{ "SHA2-512-224", vSHA2_512_224 },
-					{ "SHA2-512-256", vSHA2_512_256 }
+					{ "SHA2-512-256", vSHA2_512_256 },
+					{ "SHA3-224", vSHA3_224 },
+					{ "SHA3-256", vSHA3_256 },
+					{ "SHA3-384", vSHA3_384 },
+					{ "SHA3-512", vSHA3_512 },
+					{ "SHAKE128", vSHAKE128 },
+					{ "SHAKE256", vSHAKE256 },
+					{ "BLAKE2b", vBLAKE2B },
+					{ "BLAKE2s", vBLAKE2S },
+					{ "BLAKE3", vBLAKE3 }
 				}
 			};
 		}
+
+	private:
+		// hashes every regular file named in 'filePathSet', recursing into any directories,
+		// with algorithm class _Ty and appends the hexadecimal digests to 'out' in order
+		template <class _Ty>
+		static void appendFilesHashes(const FilePathsContainer& filePathSet, std::vector<std::string>& out) {
+			std::vector<std::filesystem::path> files;
+			for (const std::string& path : filePathSet.getData()) {
+				if (std::filesystem::exists(path) && std::filesystem::is_regular_file(path)) {
+					files.push_back(path);
+				}
+				else if (std::filesystem::exists(path) && std::filesystem::is_directory(path)) {
+					for (const std::filesystem::directory_entry& item : std::filesystem::recursive_directory_iterator(path)) {
+						if (item.is_regular_file()) {
+							files.push_back(item.path());
+						}
+					}
+				}
+			}
+			hashpp::batch::appendFileHashes<_Ty>(files, out);
+		}
 	};
 
 #if defined(HASHPP_INCLUDE_METRICS)
@@ -4594,6 +10401,107 @@ namespace hashpp {
 				}
 			}
 		}
+		// Function to check every kernel the processor supports against the portable implementations,
+		// withholding each set of extensions in 'configurations' in turn so that kernels the processor
+		// would not select by default are covered too; compares random message lengths, random update
+		// chunkings, batches and HMACs, and checks the RFC/FIPS test vectors, returning true if all pass.
+		// Any restriction set via cpu::disable is replaced by HASHPP_DISABLE_EXTENSIONS afterwards
+		bool checkKernels() const {
+			uint64_t seed = 0x9e3779b97f4a7c15ULL;
+			std::vector<std::string> messages;
+			for (const size_t length : { 0, 1, 3, 55, 56, 63, 64, 65, 71, 72, 103, 104, 111, 112, 127, 128, 129, 135, 136, 143, 144, 239, 240,
+				1024, 1025, 5121, 66561 }) {
+				messages.push_back(random(length, seed));
+			}
+			for (uint32_t i = 0; i < 48; ++i) {
+				messages.push_back(random(next(seed) % 1100, seed));
+			}
+			const std::string keys[2] = { random(20, seed), random(200, seed) };
+
+			// reference digests from the portable implementations
+			hashpp::cpu::disable("all");
+			std::vector<std::vector<std::string>> expected(this->algorithms.size()), expectedHMAC(this->algorithms.size());
+			for (size_t a = 0; a < this->algorithms.size(); ++a) {
+				for (const std::string& message : messages) {
+					expected[a].push_back(hashpp::get::getHash(this->algorithms[a], message).getString());
+					for (const std::string& key : keys) {
+						expectedHMAC[a].push_back(hashpp::get::getHMAC(this->algorithms[a], key, message).getString());
+					}
+				}
+			}
+			std::vector<std::string> expectedXOF;
+			for (const std::string& message : messages) {
+				expectedXOF.push_back(squeezed<hashpp::SHA::SHAKE128>(message, 500, false, seed));
+				expectedXOF.push_back(squeezed<hashpp::SHA::SHAKE256>(message, 500, false, seed));
+			}
+
+			bool pass = true;
+			for (const char* withheld : this->configurations) {
+				hashpp::cpu::disable(withheld);
+				std::cout << "Withholding '" << withheld << "':" << std::endl;
+
+				for (size_t a = 0; a < this->algorithms.size(); ++a) {
+					const hashpp::ALGORITHMS algorithm = this->algorithms[a];
+					if (algorithm == hashpp::ALGORITHMS::MD2 && !IncludeMD2) {
+						continue;
+					}
+
+					bool ok = hashpp::get::getHash(algorithm, this->vectors[a][0]).getString() == this->vectors[a][1]
+						&& hashpp::get::getHash(algorithm, this->vectors[a][2]).getString() == this->vectors[a][3];
+					for (size_t m = 0; m < messages.size(); ++m) {
+						ok = ok && hashpp::get::getHash(algorithm, messages[m]).getString() == expected[a][m]
+							&& chunkedHash(algorithm, messages[m], seed) == expected[a][m];
+					}
+
+					// batches of several sizes, as the multi-buffer kernel chosen depends on it
+					for (const size_t size : { size_t(2), size_t(5), size_t(12), messages.size() }) {
+						const std::vector<std::string> batch(messages.begin(), messages.begin() + size);
+						ok = ok && collected(hashpp::get::getHashes(hashpp::DataContainer(algorithm, batch)))
+							== std::vector<std::string>(expected[a].begin(), expected[a].begin() + size);
+
+						for (size_t k = 0; k < 2; ++k) {
+							std::vector<std::string> expectedKey;
+							for (size_t m = 0; m < size; ++m) {
+								ok = ok && hashpp::get::getHMAC(algorithm, keys[k], messages[m]).getString() == expectedHMAC[a][m * 2 + k];
+								expectedKey.push_back(expectedHMAC[a][m * 2 + k]);
+							}
+							ok = ok && collected(hashpp::get::getHMACs(hashpp::HMAC_DataContainer(algorithm, batch, keys[k]))) == expectedKey;
+						}
+					}
+
+					std::cout << this->comparisons[static_cast<uint8_t>(algorithm)].second << " (" << hashpp::cpu::kernel(algorithm)
+						<< ") " << (ok ? "pass." : "fail.") << std::endl;
+					pass = pass && ok;
+				}
+
+				// SHAKE output squeezed across several blocks, with input and output in random chunks
+				bool ok = hashpp::get::getHash(hashpp::ALGORITHMS::SHAKE128, "abc").getString() == this->xofVectors[0]
+					&& hashpp::get::getHash(hashpp::ALGORITHMS::SHAKE256, "abc").getString() == this->xofVectors[1];
+				for (size_t m = 0; m < messages.size(); ++m) {
+					ok = ok && squeezed<hashpp::SHA::SHAKE128>(messages[m], 500, true, seed) == expectedXOF[m * 2]
+						&& squeezed<hashpp::SHA::SHAKE256>(messages[m], 500, true, seed) == expectedXOF[m * 2 + 1];
+				}
+
+				// and batches, whose digests are the first 32 and 64 bytes of that output
+				for (const size_t size : { size_t(5), messages.size() }) {
+					const std::vector<std::string> batch(messages.begin(), messages.begin() + size);
+					const std::vector<std::string> digests128 = collected(hashpp::get::getHashes(hashpp::DataContainer(hashpp::ALGORITHMS::SHAKE128, batch)));
+					const std::vector<std::string> digests256 = collected(hashpp::get::getHashes(hashpp::DataContainer(hashpp::ALGORITHMS::SHAKE256, batch)));
+					ok = ok && digests128.size() == size && digests256.size() == size;
+					for (size_t m = 0; ok && m < size; ++m) {
+						ok = digests128[m] == expectedXOF[m * 2].substr(0, 64) && digests256[m] == expectedXOF[m * 2 + 1].substr(0, 128);
+					}
+				}
+				std::cout << "SHAKE128/SHAKE256 (" << hashpp::cpu::kernel(hashpp::ALGORITHMS::SHAKE128) << ") "
+					<< (ok ? "pass." : "fail.") << std::endl;
+				pass = pass && ok;
+			}
+
+			const char* env = std::getenv("HASHPP_DISABLE_EXTENSIONS");
+			hashpp::cpu::disable(env != nullptr ? env : "");
+			return pass;
+		}
+
 
 	private:
 		const std::vector<hashpp::ALGORITHMS> algorithms = {
@@ -4606,7 +10514,14 @@ namespace hashpp {
 			hashpp::ALGORITHMS::SHA2_384,
 			hashpp::ALGORITHMS::SHA2_512,
 			hashpp::ALGORITHMS::SHA2_512_224,
-			hashpp::ALGORITHMS::SHA2_512_256
+			hashpp::ALGORITHMS::SHA2_512_256,
+			hashpp::ALGORITHMS::SHA3_224,
+			hashpp::ALGORITHMS::SHA3_256,
+			hashpp::ALGORITHMS::SHA3_384,
+			hashpp::ALGORITHMS::SHA3_512,
+			hashpp::ALGORITHMS::BLAKE2B,
+			hashpp::ALGORITHMS::BLAKE2S,
+			hashpp::ALGORITHMS::BLAKE3
 		};
 
 		// All correct hashes of data 'd' for comparison
@@ -4620,7 +10535,16 @@ namespace hashpp {
 			{ "8ac10705a78a2dcd15fa577bac70762708597a02e130d8a6192d73dababd2b14502dbeee29d0e22bc341a0c42af6a4fb", "SHA2-384" },
 			{ "48fb10b15f3d44a09dc82d02b06581e0c0c69478c9fd2cf8f9093659019a1687baecdbb38c9e72b12169dc4148690f87467f9154f5931c5df665c6496cbfd5f5", "SHA2-512" },
 			{ "a8c9aa3f45f2ada72e3ae9278407b4ade221490596c69b27af611dae", "SHA2-512/224" },
-			{ "9a895196448c0a9daa9769b48f29db5b41cfe2f6f65943a8ef2b8f446e388f7e", "SHA2-512/256" }
+			{ "9a895196448c0a9daa9769b48f29db5b41cfe2f6f65943a8ef2b8f446e388f7e", "SHA2-512/256" },
+			{ "af81fd2b118fc4b3ed11bd42e7c056de57e29fcde0b0f236adaa4e25", "SHA3-224" },
+			{ "4ce8765e720c576f6f5a34ca380b3de5f0912e6e3cc5355542c363891e54594b", "SHA3-256" },
+			{ "0312ab38cafbaa6fffe82ab1aeafcce1d4c656c5fde60444232a374df23d6c364c4f33bb044ae258e25111227c9d57da", "SHA3-384" },
+			{ "4668897682ccd2b1ee0cae8dc55947291f819cc59ee126f5bd243b1852577414413aeed5780b5fb11090038715beed1b00714a15b31c8d9674fbdbdf7fd4191c", "SHA3-512" },
+			{ "5943bb0f0a00c1990d9a1057656bd983b8fbf44363127d15848d3ba54c3561b1", "SHAKE128" },
+			{ "0142aad0876d139fe243d071563a634d56d2e3e1d15a8edf51f16b98d26467d2f7d7b5c9bc5921e02d35efaee46a057ed27d750ea166e5f1ec526f1f16e634db", "SHAKE256" },
+			{ "0fddfe69251fd8b811a37bb45f8ef0c8485d3e60d84361d15701a5603b30cfcd572bd0bccd1e108dd697c7c53c492c188a42029b1b8a47c9ecf9ac311fc0a3e8", "BLAKE2b" },
+			{ "9c5889e3ab01635e2936b93aa64f15c1d781f1bb7b64d3640c67d25ed88dd269", "BLAKE2s" },
+			{ "d5ede538f628f687e5e0422c7755b503653de2dcd7053ca8791afa5d4787d843", "BLAKE3" }
 		};
 
 		// All correct hashes of data 'd' with key 'k' for HMAC comparison
@@ -4634,8 +10558,142 @@ namespace hashpp {
 			{ "48da203588bac88ca21d843f0dd201e15e33fe08a4db11ff4f07d2b62e2e10dee4e55d49612a658a9e5ac2c0a6b8e945", "SHA2-384" },
 			{ "75e6621bf12000a13d8dae79fed84aadffbbceaefd36ae061493b34aef6a2988f0fb91b8ba4fef293ed0bd09e6bb7578858b8f2f7f70fe3ca7490d37f655fd38", "SHA2-512" },
 			{ "7882112b43ad00ad1a01bc1a8df3745aad04e27a999ceb60da32bb18", "SHA2-512/224" },
-			{ "df48fa6a1e87fc2ccdce7a79028b4cd891ce905ebf411898c9aba975f3a2f8ad", "SHA2-512/256" }
+			{ "df48fa6a1e87fc2ccdce7a79028b4cd891ce905ebf411898c9aba975f3a2f8ad", "SHA2-512/256" },
+			{ "70224031c7070c4e0e7e6c82541814f5bd1ecc470c3c7d67b8f7a945", "SHA3-224" },
+			{ "91a1dd3b1b6bd23db80cfa5d481e369d9d7c5d9dbab2e632e5beaa227ac16970", "SHA3-256" },
+			{ "7d15e89ede0ec66fd81e0e693a6e3990b445f626c59b4850fa87b6b3d2d3545617d5df23ed5f8b3a487d17e5533a4d69", "SHA3-384" },
+			{ "6aafff695977db9aa7c39359c2640f2858a9227ed9f2aadafa529d83514821106da883fd3d0e5366204fa9521bd5060ad6fe3e81976c4c155cc8922f29354cd0", "SHA3-512" },
+			{ "", "SHAKE128" }, // no HMAC construction
+			{ "", "SHAKE256" },
+			{ "715d3dc65e4d8ba1b44d61095f71490603536f69597b5f9c48b9ca918ded91362999346cca42d6e46f69f131f1f0d94c4bb7c6bab07a2d9278c3c1f04bf6bc29", "BLAKE2b" }, // keyed mode
+			{ "3a31f25c56979b9f48d41a4b92df15b105deb051d055b58cfb7a228c2cc25ba0", "BLAKE2s" },
+			{ "9b6a5b7145d2c652bfddaad269f860bd91e8161128a0a984e67494f6e51df711", "BLAKE3" }
 		};
+
+		// sets of extensions withheld in turn by checkKernels (withholding AVX2 also withholds AVX-512)
+		const std::vector<const char*> configurations = {
+			"", "avx512", "avx2", "sha", "sha,avx512", "sha,bmi2", "sha,avx2", "sha,avx2,ssse3", "avx2,sse4.1"
+		};
+
+		// RFC 1319/1320/1321, FIPS 180, FIPS 202, RFC 7693 and BLAKE3 test vectors (message, digest, message, digest)
+		const std::vector<std::vector<std::string>> vectors = {
+			{ "abc", "900150983cd24fb0d6963f7d28e17f72", "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+			{ "abc", "a448017aaf21d8525fc10ae87aa6729d", "message digest", "d9130a8164549fe818874806e1c7014b" },
+			{ "abc", "da853b0d3f88d99b30283a69e6ded6bb", "message digest", "ab4f496bfb2a530b219ff33031fe06b0" },
+			{ "abc", "a9993e364706816aba3e25717850c26c9cd0d89d", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+			{ "abc", "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "75388b16512776cc5dba5da1fd890150b0c6455cb4f58b1952522525" },
+			{ "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+			{ "abc", "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", "09330c33f71147e83d192fc782cd1b4753111b173b3b05d22fa08086e3b0f712fcc7c71a557e2db966c3e9fa91746039" },
+			{ "abc", "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909" },
+			{ "abc", "4634270f707b6a54daae7530460842e20e37ed265ceee9a43e8924aa", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", "23fec5bb94d60b23308192640b0c453335d664734fe40e7268674af9" },
+			{ "abc", "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", "3928e184fb8690f840da3988121d31be65cb9d3ef83ee6146feac861e19b563a" },
+			{ "abc", "e642824c3f8cf24ad09234ee7d3c766fc9a3a5168d0c94ad73b46fdf", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "8a24108b154ada21c9fd5574494479ba5c7e7ab76ef264ead0fcce33" },
+			{ "abc", "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "41c0dba2a9d6240849100376a8235e2c82e1b9998a999e21db32dd97496d3376" },
+			{ "abc", "ec01498288516fc926459f58e2c6ad8df9b473cb0fc08c2596da7cf0e49be4b298d88cea927ac7f539f1edf228376d25", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "991c665755eb3a4b6bbdfb75c78a492e8c56a22c5c4d7e429bfdbc32b9d4ad5aa04a1f076e62fea19eef51acd0657c22" },
+			{ "abc", "b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "04a371e84ecfb5b8b77cb48610fca8182dd457ce6f326a0fd3d7ec2f1e91636dee691fbe0c985302ba1b0d8dc78c086346b533b49c030d99a27daf1139d6e75e" },
+			{ "abc", "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923", "", "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce" },
+			{ "abc", "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982", "", "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9" },
+			{ "abc", "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85", "", "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" }
+		};
+
+		// FIPS 202 SHAKE128 and SHAKE256 digests (their first 32 and 64 bytes of output) of "abc"
+		const std::vector<std::string> xofVectors = {
+			"5881092dd818bf5cf8a3ddb793fbcba74097d5c526a6d35f97b83351940f2cc8",
+			"483366601360a8771c6863080cc4114d8db44530f8f1e1ee4f94ea37e78b5739d5a15bef186a5386c75744c0527e1faa9f8726e462a12a4feb06bd8801e751e4"
+		};
+
+		// xorshift64 generator used for the random messages and chunkings of checkKernels
+		static uint64_t next(uint64_t& seed) noexcept {
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			return seed;
+		}
+
+		static std::string random(size_t length, uint64_t& seed) {
+			std::string data(length, '\0');
+			for (char& c : data) {
+				c = static_cast<char>(next(seed));
+			}
+			return data;
+		}
+
+		// digests of a single-algorithm collection, in order
+		static std::vector<std::string> collected(const hashpp::hashCollection& collection) {
+			for (const std::pair<std::string, std::vector<std::string>>& idHashes : collection) {
+				if (!idHashes.second.empty()) {
+					return idHashes.second;
+				}
+			}
+			return std::vector<std::string>();
+		}
+
+		// hashes 'data' with algorithm class _Alg, passed to ctx_update in chunks of random lengths
+		template <class _Alg>
+		static std::string chunkedHash(const std::string& data, uint64_t& seed) {
+			_Alg alg;
+			hashpp::common& c = alg;
+			c.ctx_init();
+			for (size_t i = 0; i < data.length();) {
+				const size_t n = static_cast<size_t>(1 + next(seed) % 200);
+				const size_t len = n < data.length() - i ? n : data.length() - i;
+				c.ctx_update(reinterpret_cast<const uint8_t*>(data.data()) + i, len);
+				i += len;
+			}
+			c.ctx_final();
+			return c.bytesToHexString();
+		}
+
+		// the first 'n' bytes of output of XOF class _Xof for 'data' as hexadecimal, absorbing the
+		// input and squeezing the output in chunks of random lengths if 'chunked' is set
+		template <class _Xof>
+		static std::string squeezed(const std::string& data, size_t n, bool chunked, uint64_t& seed) {
+			const char* digits = "0123456789abcdef";
+			std::vector<uint8_t> out(n);
+			std::string hex;
+			_Xof xof;
+
+			for (size_t i = 0; i < data.length();) {
+				size_t len = chunked ? 1 + next(seed) % 200 : data.length();
+				if (len > data.length() - i) len = data.length() - i;
+				xof.update(data.data() + i, len);
+				i += len;
+			}
+			for (size_t i = 0; i < n;) {
+				size_t len = chunked ? next(seed) % 300 : n;
+				if (len > n - i) len = n - i;
+				xof.squeeze(out.data() + i, len);
+				i += len;
+			}
+			for (const uint8_t b : out) {
+				hex += digits[b >> 4];
+				hex += digits[b & 0x0F];
+			}
+			return hex;
+		}
+
+		static std::string chunkedHash(hashpp::ALGORITHMS algorithm, const std::string& data, uint64_t& seed) {
+			switch (algorithm) {
+			case hashpp::ALGORITHMS::MD5: return chunkedHash<hashpp::MD::MD5>(data, seed);
+			case hashpp::ALGORITHMS::MD4: return chunkedHash<hashpp::MD::MD4>(data, seed);
+			case hashpp::ALGORITHMS::MD2: return chunkedHash<hashpp::MD::MD2>(data, seed);
+			case hashpp::ALGORITHMS::SHA1: return chunkedHash<hashpp::SHA::SHA1>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_224: return chunkedHash<hashpp::SHA::SHA2_224>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_256: return chunkedHash<hashpp::SHA::SHA2_256>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_384: return chunkedHash<hashpp::SHA::SHA2_384>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_512: return chunkedHash<hashpp::SHA::SHA2_512>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_512_224: return chunkedHash<hashpp::SHA::SHA2_512_224>(data, seed);
+			case hashpp::ALGORITHMS::SHA2_512_256: return chunkedHash<hashpp::SHA::SHA2_512_256>(data, seed);
+			case hashpp::ALGORITHMS::SHA3_224: return chunkedHash<hashpp::SHA::SHA3_224>(data, seed);
+			case hashpp::ALGORITHMS::SHA3_256: return chunkedHash<hashpp::SHA::SHA3_256>(data, seed);
+			case hashpp::ALGORITHMS::SHA3_384: return chunkedHash<hashpp::SHA::SHA3_384>(data, seed);
+			case hashpp::ALGORITHMS::SHA3_512: return chunkedHash<hashpp::SHA::SHA3_512>(data, seed);
+			case hashpp::ALGORITHMS::BLAKE2B: return chunkedHash<hashpp::BLAKE::BLAKE2b>(data, seed);
+			case hashpp::ALGORITHMS::BLAKE2S: return chunkedHash<hashpp::BLAKE::BLAKE2s>(data, seed);
+			case hashpp::ALGORITHMS::BLAKE3: return chunkedHash<hashpp::BLAKE::BLAKE3>(data, seed);
+			default: return std::string();
+			}
+		}
 	};
 #endif
 }